@@ -0,0 +1,7 @@
+#include "assets.hpp"
+
+// The sprite sheet data is compiled here only, every other translation unit
+// sees the declarations in assets/tilemap_lz.hpp
+namespace assets {
+#include "assets/tilemap_data.hpp"
+} // namespace assets
@@ -7,11 +7,28 @@
 #include "assets/sprite.hpp"
 
 namespace assets {
-// #include "assets/monochrome_tilemap_packed.hpp"
-#include "assets/tilemap.hpp"
+// Generated from assets/monochrome_tilemap_packed.png by `make assets`, the
+// frame data itself is defined in assets.cpp
+#include "assets/tilemap_lz.hpp"
+#include "assets/font.hpp"
+#include "assets/level.hpp"
+
+/// @brief the stored frame that draws frame `sheetIndex` of the full sheet, with the flips it needs above bit 12
+/// @return -1 if the frame was left out
+constexpr int atlasFrame(int sheetIndex) {
+    for (int i = 0; i < tilemapReferenced; i++) {
+        if (tilemapSheetFrames[i] == sheetIndex) {
+            return tilemapRemap[i];
+        }
+    }
+    return -1;
+}
 
-constexpr uint16_t spriteIndex(uint16_t i, uint16_t j) {
-    return j * 20 + i;
+// Only frames named through spriteIndex() or used by the level are in the
+// cart; run `make assets` after adding one. A frame that was left out gives
+// -1, which does not compile as a SpriteFrame.
+constexpr int spriteIndex(int i, int j) {
+    return atlasFrame(j * 20 + i);
 }
 
 enum class SpriteFrame : uint16_t {
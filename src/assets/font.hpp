@@ -0,0 +1,16 @@
+// 8x8 digits, one glyph after the other as an 8 pixel wide 1bpp strip. Set
+// bits are ink, drawn in draw color 1 like the built-in font.
+inline const char fontFirst = '0';
+inline const int fontGlyphs = 10;
+inline const uint8_t font[fontGlyphs * 8] = {
+    0x7c, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x7c, 0x00, // 0
+    0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0xfc, 0x00, // 1
+    0x78, 0xcc, 0x0c, 0x38, 0x60, 0xcc, 0xfc, 0x00, // 2
+    0x78, 0xcc, 0x0c, 0x38, 0x0c, 0xcc, 0x78, 0x00, // 3
+    0x1c, 0x3c, 0x6c, 0xcc, 0xfe, 0x0c, 0x1e, 0x00, // 4
+    0xfc, 0xc0, 0xf8, 0x0c, 0x0c, 0xcc, 0x78, 0x00, // 5
+    0x38, 0x60, 0xc0, 0xf8, 0xcc, 0xcc, 0x78, 0x00, // 6
+    0xfc, 0xcc, 0x0c, 0x18, 0x30, 0x30, 0x30, 0x00, // 7
+    0x78, 0xcc, 0xcc, 0x78, 0xcc, 0xcc, 0x78, 0x00, // 8
+    0x78, 0xcc, 0xcc, 0x7c, 0x0c, 0x18, 0x70, 0x00, // 9
+};
@@ -0,0 +1,19 @@
+// Tiles of the level row by row, as frames of the full sprite sheet and 0 for
+// none. Frames below 100 are half height platforms.
+inline const int levelWidth = 10;
+inline const int levelHeight = 11;
+inline const uint16_t level[110] = {
+    // clang-format off
+    219,316,316,317,  0,  0,315,316,316,239,
+    297,  0,  0,  0,  0,  0,  0,  0,  0,295,
+    297,  0,  0,  0,  0,  0,  0,  0,  0,295,
+    297,  0,  0, 84, 85, 85, 86,  0,  0,295,
+    297,  0,  0,  0,  0,  0,  0,  0,  0,295,
+    297,  0,  0,  0,  0,  0, 84, 85, 85,295,
+    297, 85, 85, 86,  0,  0,  0,  0,  0,295,
+    297,  0,  0,  0,  0,  0,  0,  0,  0,295,
+    297,  0,  0, 84, 85, 85, 86,  0,  0,295,
+    297,  0,  0,  0,  0,  0,  0,  0,  0,295,
+    199,276,276,277,  0,  0,275,276,276,259,
+    // clang-format on
+};
@@ -1,5 +0,0 @@
-// tilemap
-inline const int tilemapWidth = 320;
-inline const int tilemapHeight = 320;
-
-inline const uint8_t tilemap[12800] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x7f, 0xfe, 0xf8, 0x1f, 0xff, 0xff, 0xc0, 0x43, 0xf8, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x40, 0x02, 0x40, 0x02, 0xf7, 0x8f, 0xff, 0xff, 0x81, 0x21, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x58, 0x1a, 0x40, 0x06, 0xee, 0xc7, 0xff, 0xff, 0x00, 0x08, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0x29, 0x94, 0x28, 0x14, 0x28, 0x14, 0x54, 0x2a, 0x4f, 0xf6, 0xef, 0xa7, 0xff, 0xff, 0x20, 0x14, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x87, 0xff, 0xff, 0xfc, 0x3f, 0xec, 0x37, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0x23, 0xc4, 0x23, 0xc4, 0x20, 0x04, 0x4a, 0x52, 0x4f, 0xf6, 0xee, 0xc7, 0xff, 0xff, 0x00, 0x08, 0xf0, 0x4f, 0xff, 0xff, 0xce, 0x7f, 0xff, 0xff, 0xfe, 0xc7, 0xff, 0xff, 0xfb, 0xdf, 0xe9, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xc4, 0x26, 0x64, 0x20, 0x04, 0x45, 0xa2, 0x4f, 0xf6, 0xee, 0xa7, 0xff, 0xff, 0x00, 0x02, 0xf0, 0xaf, 0xff, 0xff, 0xc4, 0x7f, 0xf7, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfa, 0x5f, 0xe9, 0x97, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x21, 0x84, 0x25, 0xa4, 0x20, 0x04, 0x43, 0x42, 0x4f, 0xf6, 0xee, 0xc7, 0xff, 0xff, 0x00, 0x00, 0xe0, 0x47, 0xff, 0xff, 0xee, 0xff, 0xfa, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfa, 0x5f, 0xe9, 0x97, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x3f, 0xee, 0x77, 0x21, 0x84, 0x25, 0xa4, 0x20, 0x04, 0x42, 0xc2, 0x4f, 0xf6, 0xee, 0xa7, 0xff, 0xff, 0x40, 0x00, 0xe0, 0x17, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xef, 0xfe, 0x3f, 0xff, 0xff, 0xfb, 0xdf, 0xe9, 0x97, 0xfe, 0x7f, 0xfe, 0x7f, 0xfd, 0xbf, 0xde, 0x7b, 0x20, 0x04, 0x26, 0x64, 0x20, 0x04, 0x45, 0xa2, 0x4f, 0xf6, 0xee, 0xc7, 0xfc, 0x3f, 0x00, 0x04, 0xe0, 0x07, 0xff, 0x93, 0xee, 0xeb, 0xfd, 0x5f, 0xfe, 0x9f, 0xff, 0xff, 0xfc, 0x3f, 0xec, 0x37, 0xfc, 0x3f, 0xfc, 0x3f, 0xf4, 0x2f, 0x9e, 0x79, 0x21, 0x84, 0x23, 0xc4, 0x20, 0x04, 0x4a, 0x52, 0x4f, 0xf6, 0xee, 0xa7, 0xf8, 0x1f, 0x10, 0x08, 0xe8, 0x07, 0xff, 0x93, 0xc4, 0x77, 0xfd, 0xbf, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xfd, 0xbf, 0xfc, 0x3f, 0xf7, 0xef, 0x9c, 0x39, 0x29, 0x94, 0x28, 0x14, 0x28, 0x14, 0x54, 0x2a, 0x4f, 0xf6, 0xee, 0xc7, 0xf8, 0x1f, 0x28, 0x00, 0xc0, 0x03, 0xff, 0xef, 0xce, 0x6b, 0xed, 0xb7, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xfd, 0xbf, 0xff, 0xff, 0xe9, 0x97, 0x88, 0x11, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x58, 0x1a, 0x40, 0x06, 0xc0, 0x03, 0xf8, 0x11, 0x10, 0x00, 0xc8, 0x03, 0xc9, 0xc7, 0xfb, 0xf7, 0xf5, 0xaf, 0xe1, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfe, 0x7f, 0xd7, 0xeb, 0xc1, 0x83, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x40, 0x02, 0x5f, 0xfe, 0xc0, 0x03, 0xf8, 0x00, 0x84, 0x01, 0xd4, 0x03, 0xc9, 0xef, 0xe0, 0xe3, 0xb5, 0xad, 0xe3, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xaf, 0xf5, 0xe3, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x88, 0x00, 0xc0, 0x03, 0xc9, 0x03, 0xf7, 0xef, 0xf1, 0xf7, 0xd5, 0xab, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfd, 0xbf, 0x5f, 0xfa, 0xff, 0xff, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0xee, 0xc7, 0x00, 0x00, 0xf0, 0x0f, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0xbf, 0xfd, 0x7f, 0xff, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0xee, 0xa7, 0xff, 0xff, 0xf6, 0x6f, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xfd, 0x7f, 0xfe, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0xee, 0xc7, 0xfe, 0x7f, 0xf8, 0x6f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xfa, 0xff, 0xff, 0x5f, 0xff, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x40, 0x02, 0xee, 0xa7, 0xfc, 0x3f, 0xfe, 0x1f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfd, 0xbf, 0xff, 0xf5, 0xff, 0xff, 0xaf, 0xff, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x40, 0x06, 0xee, 0xc7, 0xfc, 0xbf, 0xfe, 0x7f, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xfe, 0x7f, 0xfd, 0xbf, 0xfd, 0xbf, 0xff, 0xeb, 0xff, 0xff, 0xd7, 0xff, 0x3e, 0x7c, 0x3f, 0xfc, 0x3f, 0xfc, 0x3b, 0xdc, 0x4f, 0xf6, 0xee, 0xa7, 0xf8, 0x1f, 0xfc, 0x7f, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x87, 0xfe, 0x7f, 0xfd, 0xbf, 0xfa, 0x5f, 0xfc, 0x3f, 0xff, 0xd7, 0xff, 0xff, 0xeb, 0xff, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0xfc, 0x31, 0x8c, 0x4b, 0xd6, 0xee, 0xc7, 0xf8, 0x5f, 0xfc, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc7, 0xfd, 0xbf, 0xfa, 0x5f, 0xf4, 0x2f, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xf5, 0xff, 0x3c, 0x3c, 0x39, 0x9c, 0x3f, 0xfc, 0x38, 0x1c, 0x4f, 0xf6, 0xee, 0xa7, 0xf8, 0x1f, 0xfc, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0x7f, 0xfa, 0x5f, 0xf5, 0xaf, 0xe9, 0x97, 0xfe, 0x7f, 0xff, 0x5f, 0xff, 0xff, 0xfa, 0xff, 0x3e, 0x7c, 0x3a, 0x5c, 0x3f, 0xfc, 0x3c, 0x3c, 0x4f, 0xf6, 0xee, 0xc7, 0xf0, 0x0f, 0xfc, 0x7f, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfe, 0x7f, 0xfa, 0x5f, 0xf5, 0xaf, 0xe9, 0x97, 0xfe, 0x7f, 0xfe, 0xbf, 0xff, 0xff, 0xfd, 0x7f, 0x3e, 0x7c, 0x3a, 0x5c, 0x3f, 0xfc, 0x3c, 0x3c, 0x4f, 0xf6, 0xee, 0xa7, 0xf0, 0x0f, 0xfe, 0x3f, 0xfe, 0x7f, 0xe7, 0xe7, 0xff, 0xff, 0xfd, 0xbf, 0xfc, 0x7f, 0xfd, 0xbf, 0xfa, 0x5f, 0xf4, 0x2f, 0xfe, 0x7f, 0xfd, 0x7f, 0xff, 0xff, 0xfe, 0xbf, 0x3f, 0xfc, 0x39, 0x9c, 0x3f, 0xfc, 0x38, 0x1c, 0x4f, 0xf6, 0xee, 0xc7, 0xf0, 0x0f, 0xfe, 0x3f, 0xfe, 0x7f, 0xe3, 0xc7, 0xc7, 0xe3, 0xfe, 0xbf, 0xf9, 0x7f, 0xfe, 0x7f, 0xfd, 0xbf, 0xfa, 0x5f, 0xfc, 0x3f, 0xfa, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x3e, 0x7c, 0x3c, 0x3c, 0x3f, 0xfc, 0x31, 0x8c, 0x4b, 0xd6, 0xee, 0xa7, 0xf2, 0x0f, 0xfe, 0x3f, 0xfe, 0x3f, 0xf3, 0xcf, 0xc3, 0xc3, 0xfe, 0xb7, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xfd, 0xbf, 0xfd, 0xbf, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x3e, 0x7c, 0x3f, 0xfc, 0x3f, 0xfc, 0x3b, 0xdc, 0x4f, 0xf6, 0xee, 0xc7, 0xe5, 0x07, 0xfc, 0x7f, 0xfe, 0x3f, 0xf1, 0x8f, 0xc1, 0x83, 0xf6, 0xaf, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfd, 0xbf, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x2f, 0xf4, 0x40, 0x06, 0xee, 0xa7, 0xe2, 0x47, 0xfc, 0x7f, 0xfe, 0x3f, 0xf1, 0x8f, 0xe4, 0x27, 0xfa, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x5f, 0xfe, 0xee, 0xc7, 0xf0, 0x0f, 0xf8, 0x3f, 0xfc, 0x3f, 0xfd, 0xbf, 0xf2, 0x4f, 0xda, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0xee, 0xa7, 0xff, 0xff, 0xf8, 0x3f, 0xfc, 0x3f, 0xfd, 0xbf, 0xfb, 0xdf, 0xea, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xed, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0xee, 0xc7, 0xfe, 0x7f, 0xf0, 0x1f, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xee, 0xa7, 0xf0, 0x0f, 0xff, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x7f, 0xfe, 0xc0, 0x03, 0xe0, 0x07, 0xff, 0xff, 0xfa, 0x5f, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xfc, 0x3f, 0x89, 0x00, 0x00, 0x00, 0x00, 0x91, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0x40, 0x02, 0xc0, 0x03, 0x80, 0x01, 0xff, 0xff, 0xfa, 0x5f, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xff, 0xff, 0xf9, 0x9f, 0xee, 0x77, 0xfd, 0xbf, 0x89, 0xaa, 0xaa, 0xaa, 0xaa, 0x91, 0xa0, 0x05, 0xa0, 0x05, 0xa0, 0x05, 0xa0, 0x05, 0x5f, 0xfa, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0xfa, 0x5f, 0x9f, 0xf9, 0x9f, 0xf9, 0x9f, 0xf9, 0x9f, 0xf9, 0xff, 0xff, 0xf6, 0x6f, 0xd1, 0x8b, 0xfd, 0xbf, 0x89, 0x55, 0x55, 0x55, 0x55, 0x91, 0xa9, 0x95, 0xa8, 0x15, 0xa8, 0x15, 0xac, 0x35, 0x55, 0x5a, 0xee, 0xa7, 0x92, 0x49, 0xe0, 0x07, 0xfa, 0x3f, 0x9f, 0xf9, 0x9f, 0xf9, 0x93, 0xf9, 0x9f, 0xf9, 0xf9, 0x9f, 0xe9, 0x97, 0xa0, 0x25, 0xfc, 0x3f, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xa3, 0xc5, 0xa3, 0xc5, 0xa0, 0x05, 0xaa, 0x55, 0x5a, 0xaa, 0xee, 0xc7, 0xff, 0xff, 0xc0, 0x03, 0xfa, 0x7f, 0x90, 0x09, 0x90, 0x09, 0x93, 0xf9, 0x9f, 0xf9, 0xf0, 0x0f, 0xd0, 0x0b, 0xa0, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xc5, 0xa6, 0x65, 0xa0, 0x05, 0xa5, 0xa5, 0x55, 0x5a, 0xee, 0xa7, 0xfc, 0x3f, 0xc0, 0x03, 0xfa, 0x7f, 0x90, 0x09, 0x90, 0x09, 0x93, 0xf9, 0x9f, 0xf9, 0xf0, 0x0f, 0xd0, 0x0b, 0xa0, 0x25, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x85, 0xa5, 0xa5, 0xa0, 0x05, 0xa3, 0x45, 0x5a, 0xaa, 0xee, 0xc7, 0xfe, 0x7f, 0xc0, 0x03, 0xfa, 0x5f, 0x90, 0x09, 0x91, 0x89, 0x93, 0xf9, 0x9f, 0xf9, 0xf8, 0x1f, 0xe8, 0x17, 0xd0, 0x0b, 0xf2, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x85, 0xa5, 0xa5, 0xa0, 0x05, 0xa2, 0xc5, 0x55, 0x5a, 0xee, 0xa7, 0xfe, 0x7f, 0xff, 0xff, 0xfc, 0x5f, 0x90, 0x09, 0x93, 0xc9, 0x93, 0xf9, 0x9f, 0xf9, 0xfc, 0x3f, 0xf4, 0x2f, 0xe8, 0x17, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x05, 0xa6, 0x65, 0xa0, 0x05, 0xa5, 0xa5, 0x5a, 0xaa, 0xee, 0xc7, 0xfe, 0x7f, 0xf4, 0x2f, 0xfe, 0x3f, 0x90, 0x69, 0x93, 0xc9, 0x93, 0xf9, 0x9f, 0xf9, 0xfe, 0x7f, 0xfa, 0x5f, 0xf4, 0x2f, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x85, 0xa3, 0xc5, 0xa0, 0x05, 0xaa, 0x55, 0x55, 0x5a, 0xee, 0xa7, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x90, 0xe9, 0x91, 0x89, 0x91, 0xf9, 0x9f, 0xf9, 0xff, 0xff, 0xfd, 0xbf, 0xfa, 0x5f, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x95, 0xa8, 0x15, 0xa8, 0x15, 0xac, 0x35, 0x5a, 0xaa, 0xef, 0xc7, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x3f, 0x90, 0x69, 0x91, 0x89, 0x93, 0xf9, 0x9f, 0xf9, 0xff, 0xff, 0xfe, 0x7f, 0xfd, 0xbf, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x05, 0xa0, 0x05, 0xa0, 0x05, 0xa0, 0x05, 0x5f, 0xfa, 0xee, 0xa7, 0xfe, 0x7f, 0xc6, 0x77, 0xfe, 0x3f, 0x90, 0x09, 0x90, 0x09, 0x93, 0xf9, 0x9f, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0x40, 0x02, 0xf7, 0xcf, 0xfe, 0x7f, 0x82, 0x63, 0xfc, 0x3f, 0x90, 0x09, 0x90, 0x09, 0x93, 0xf9, 0x9f, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x7f, 0xfe, 0xf8, 0x1f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0x1f, 0x90, 0x09, 0x90, 0x09, 0x93, 0x59, 0x95, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x7f, 0xee, 0x77, 0xf0, 0x07, 0x90, 0x09, 0x90, 0x09, 0x92, 0xa9, 0x9a, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc8, 0x13, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x67, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x67, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0x80, 0x01, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x80, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xaf, 0xf5, 0xaf, 0xf5, 0xaf, 0xf5, 0xaf, 0xf5, 0x86, 0x01, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x9f, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xbe, 0x7d, 0xbf, 0xfd, 0xbf, 0xfd, 0xbb, 0xdd, 0xc6, 0x03, 0x43, 0x02, 0x40, 0xc2, 0x41, 0x82, 0x41, 0x82, 0x40, 0x02, 0x41, 0x82, 0x9f, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xe0, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbc, 0x3d, 0xbc, 0x3d, 0xbf, 0xfd, 0xb1, 0x8d, 0x80, 0x01, 0x47, 0xf2, 0x4f, 0xe2, 0x43, 0xc2, 0x41, 0x82, 0x40, 0x02, 0x41, 0x82, 0x90, 0x01, 0x80, 0x09, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xf8, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xbc, 0x3d, 0xb9, 0x9d, 0xbf, 0xfd, 0xb8, 0x1d, 0xa0, 0x01, 0x4f, 0xf2, 0x4f, 0xf2, 0x47, 0xe2, 0x47, 0xe2, 0x40, 0x02, 0x41, 0x82, 0x97, 0xfd, 0xbf, 0xe9, 0xcf, 0xf3, 0xe7, 0xe7, 0xf7, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x7d, 0xba, 0x5d, 0xbf, 0xfd, 0xbc, 0x3d, 0x90, 0x05, 0x47, 0xf2, 0x4f, 0xe2, 0x41, 0x82, 0x43, 0xc2, 0x40, 0x02, 0x40, 0x02, 0x94, 0x05, 0xa0, 0x29, 0xcf, 0xf3, 0xe7, 0xe7, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x7d, 0xba, 0x5d, 0xbf, 0xfd, 0xbc, 0x3d, 0xa0, 0x09, 0x43, 0x02, 0x40, 0xc2, 0x41, 0x82, 0x41, 0x82, 0x40, 0x02, 0x41, 0x82, 0x94, 0x01, 0x80, 0x29, 0xc8, 0x13, 0xe4, 0x27, 0xfd, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfd, 0xb9, 0x9d, 0xbf, 0xfd, 0xb8, 0x1d, 0x80, 0x05, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x94, 0x0d, 0xb0, 0x29, 0xc8, 0x13, 0xf4, 0x2f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x7d, 0xbc, 0x3d, 0xbf, 0xfd, 0xb1, 0x8d, 0x80, 0x01, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x94, 0x1d, 0xb8, 0x29, 0xcf, 0xf3, 0xd7, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x7d, 0xbf, 0xfd, 0xbf, 0xfd, 0xbb, 0xdd, 0xc0, 0x1b, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x94, 0x0d, 0xb0, 0x29, 0xcf, 0xf3, 0xd7, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xf5, 0xaf, 0xf5, 0xaf, 0xf5, 0xaf, 0xf5, 0x90, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x01, 0x80, 0x29, 0xc8, 0x13, 0xf4, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0xbf, 0xfd, 0x80, 0x01, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x94, 0x05, 0xa0, 0x29, 0xc8, 0x13, 0xe4, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc8, 0x13, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x97, 0xfd, 0xbf, 0xe9, 0xcf, 0xf3, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x90, 0x01, 0x80, 0x09, 0xcf, 0xf3, 0xe7, 0xe7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x9f, 0xe6, 0x7f, 0xcf, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x13, 0xe4, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xc8, 0x13, 0xe4, 0x27, 0xff, 0xff, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x40, 0x02, 0x4d, 0xfe, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0x1f, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x01, 0xcf, 0xf3, 0xe7, 0xe7, 0xf0, 0x0f, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xec, 0x60, 0x19, 0x80, 0x30, 0x37, 0x5f, 0xfa, 0x46, 0xfe, 0xf8, 0xff, 0xff, 0x1f, 0xf0, 0x0f, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xf9, 0xcf, 0xf3, 0xe7, 0xe7, 0xef, 0xf7, 0x98, 0x19, 0xc8, 0x18, 0x18, 0x18, 0x18, 0x13, 0xd0, 0x00, 0x00, 0x10, 0x00, 0x0b, 0x5f, 0xfa, 0x63, 0x7e, 0xf0, 0x03, 0xc0, 0x0f, 0xe0, 0x07, 0xf8, 0x1f, 0xe1, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0xc9, 0xc8, 0x13, 0xe4, 0x27, 0xd8, 0x1b, 0xfc, 0x3f, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0xd1, 0x80, 0x00, 0x28, 0x0c, 0x0b, 0x5f, 0xfa, 0x71, 0xbe, 0xe0, 0x03, 0xc0, 0x07, 0xe0, 0x07, 0xf8, 0x1f, 0xc0, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0xc9, 0xc8, 0x13, 0xf4, 0x2f, 0xd7, 0xeb, 0xce, 0x73, 0xce, 0x72, 0x4e, 0x72, 0x4e, 0x73, 0xa1, 0x00, 0x20, 0x00, 0x04, 0x05, 0x5f, 0xfa, 0x78, 0xde, 0xc0, 0x03, 0xc0, 0x03, 0xf8, 0x1f, 0xe0, 0x07, 0xcc, 0xff, 0xf9, 0xff, 0x93, 0xff, 0xff, 0xc9, 0xcf, 0xf3, 0xd7, 0xeb, 0xd7, 0x0b, 0xcb, 0xd3, 0xcb, 0xd3, 0xcb, 0xd3, 0xcb, 0xd3, 0xac, 0x00, 0x50, 0x04, 0x00, 0x35, 0x5f, 0xfa, 0x5c, 0x6e, 0xc0, 0x03, 0xc0, 0x03, 0xf8, 0x1f, 0xe0, 0x07, 0xcc, 0x03, 0xf6, 0x0f, 0x93, 0xff, 0xff, 0xc9, 0xcf, 0xf3, 0xd7, 0xeb, 0xdb, 0x1b, 0xfe, 0x7f, 0xfe, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0xa8, 0xc0, 0x00, 0x0a, 0x00, 0x15, 0x5f, 0xfa, 0x4e, 0x36, 0xe0, 0x03, 0xc0, 0x07, 0xf8, 0x1f, 0xf0, 0x0f, 0xcc, 0x03, 0xf6, 0x0f, 0x93, 0xff, 0xff, 0xc9, 0xc8, 0x13, 0xf4, 0x2f, 0xed, 0x37, 0xf6, 0x6f, 0xf6, 0x7d, 0xf6, 0x7d, 0xf6, 0x7f, 0xa0, 0x80, 0x00, 0x00, 0x00, 0xc5, 0x5f, 0xfa, 0x67, 0x1a, 0xf0, 0x03, 0xc0, 0x0f, 0xf8, 0x1f, 0xf8, 0x1f, 0xcc, 0xff, 0xf9, 0xaf, 0x93, 0xff, 0xff, 0xc9, 0xc8, 0x13, 0xe4, 0x27, 0xf6, 0x6f, 0xff, 0xff, 0xff, 0xef, 0xff, 0xef, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x5f, 0xfa, 0x73, 0x8e, 0xf8, 0xff, 0xff, 0x1f, 0xf8, 0x1f, 0xfc, 0x3f, 0xc0, 0xc3, 0xff, 0xff, 0x91, 0xff, 0xff, 0x89, 0xcf, 0xf3, 0xe7, 0xe7, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5f, 0xfa, 0x79, 0xc6, 0xfc, 0xff, 0xff, 0x3f, 0xf8, 0x1f, 0xfe, 0x7f, 0xe1, 0xdb, 0xff, 0xff, 0x93, 0xff, 0xff, 0xc9, 0xcf, 0xf3, 0xe7, 0xe7, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x5f, 0xfa, 0x7c, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0xc9, 0xc8, 0x13, 0xe4, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x02, 0x7e, 0x72, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xff, 0xc9, 0xc8, 0x13, 0xe4, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7f, 0xfe, 0x7f, 0xfe, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x93, 0x55, 0x55, 0x49, 0xcf, 0xf3, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x92, 0xaa, 0xaa, 0xc9, 0xcf, 0xf3, 0xe7, 0xe7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0xff, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0xff, 0xfe, 0xc8, 0x13, 0xe4, 0x27, 0xff, 0xff, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa1, 0x00, 0x60, 0x00, 0x00, 0x85, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xc8, 0x13, 0xf4, 0x2f, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x46, 0x00, 0x00, 0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x02, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xcf, 0xf3, 0xd7, 0xeb, 0xfd, 0xbf, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa1, 0x00, 0x06, 0x00, 0x00, 0x8c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xcf, 0xf3, 0xd7, 0xeb, 0xfa, 0x5f, 0x98, 0x19, 0x98, 0x18, 0x18, 0x18, 0x18, 0x19, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xff, 0xff, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xff, 0xff, 0xc8, 0x13, 0xf4, 0x2f, 0xf5, 0xaf, 0xbc, 0x3d, 0xbc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 0xa0, 0x00, 0x30, 0x00, 0x00, 0x05, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x13, 0xe4, 0x27, 0xf5, 0xaf, 0xe6, 0x67, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x67, 0xa0, 0x00, 0x20, 0x00, 0x00, 0x45, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x59, 0xbf, 0xfd, 0x9f, 0xff, 0xda, 0x7d, 0x9a, 0xff, 0xff, 0xcf, 0xf3, 0xe7, 0xe7, 0xf5, 0x2f, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x30, 0x00, 0x00, 0x00, 0x00, 0x25, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x79, 0xff, 0xff, 0x9f, 0xff, 0xfe, 0x7f, 0x9e, 0xff, 0xff, 0xcf, 0xf3, 0xe7, 0xe7, 0xf4, 0xaf, 0xf9, 0x9f, 0xf9, 0x99, 0x99, 0x99, 0x99, 0x9f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x45, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f, 0xfc, 0x3f, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0xa0, 0x00, 0x00, 0x04, 0x00, 0x05, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x2f, 0xfe, 0x7f, 0xfe, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0xa4, 0x00, 0x00, 0x0c, 0x00, 0x05, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x80, 0x00, 0x60, 0x01, 0x05, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x00, 0x00, 0x62, 0x00, 0x85, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x80, 0x00, 0x06, 0x01, 0x05, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xcf, 0xf3, 0xe7, 0xe7, 0xff, 0xff, 0xe6, 0x67, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x67, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xc8, 0x13, 0xe4, 0x27, 0xff, 0xff, 0xd9, 0x9b, 0xd9, 0x99, 0x99, 0x99, 0x99, 0x9b, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xc8, 0x13, 0xf4, 0x2f, 0xff, 0xff, 0xa0, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfa, 0xff, 0xff, 0xcf, 0xf3, 0xd7, 0xeb, 0xff, 0xff, 0x5f, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfe, 0xff, 0xff, 0xcf, 0xf3, 0xd7, 0xeb, 0xff, 0xff, 0x30, 0xcc, 0x33, 0x33, 0x33, 0x33, 0x33, 0xcc, 0x30, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xc8, 0x13, 0xf4, 0x2f, 0xff, 0xff, 0xac, 0x75, 0xad, 0x11, 0x11, 0x11, 0x11, 0xb5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x15, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xfe, 0xff, 0xff, 0xc8, 0x13, 0xe4, 0x27, 0xff, 0xff, 0xae, 0x35, 0xad, 0x88, 0x88, 0x88, 0x88, 0xb5, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x35, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xcf, 0xf3, 0xe7, 0xe7, 0xff, 0xff, 0x33, 0x0c, 0x33, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xa0, 0x80, 0x00, 0x0a, 0x03, 0x05, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x27, 0xfe, 0xff, 0xff, 0xcf, 0xf3, 0xe7, 0xe7, 0xff, 0xff, 0x5f, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xa8, 0xc0, 0x50, 0x04, 0x00, 0x05, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x27, 0xfe, 0xff, 0xff, 0xc8, 0x13, 0xe4, 0x27, 0xe7, 0xe7, 0xa0, 0x05, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xac, 0x00, 0x20, 0x00, 0x00, 0x85, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xc8, 0x13, 0xe4, 0x27, 0xd3, 0xd3, 0xd9, 0x9b, 0xd9, 0x99, 0x99, 0x99, 0x99, 0x9b, 0xd0, 0x00, 0x00, 0x28, 0x01, 0x8b, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xfe, 0xff, 0xff, 0xcf, 0xf3, 0xe7, 0xe7, 0xd3, 0xd3, 0xe6, 0x67, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x67, 0xd0, 0x00, 0x00, 0x10, 0x00, 0x0b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xcf, 0xf3, 0xe7, 0xe7, 0xb1, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x0c, 0x19, 0x80, 0x06, 0x37, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xb1, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x87, 0xe1, 0xff, 0xff, 0x70, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x87, 0xe1, 0xc3, 0xc3, 0x70, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xe6, 0x7f, 0xf9, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xc1, 0xff, 0xff, 0x1c, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x00, 0x3e, 0x44, 0x00, 0x42, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xbf, 0xff, 0xc9, 0x93, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x42, 0x00, 0x22, 0x7c, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x67, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x67, 0x38, 0xff, 0xff, 0x83, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xab, 0xde, 0xd5, 0xae, 0xd5, 0xae, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xdf, 0xfb, 0x6f, 0xdb, 0x6f, 0xdb, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xaf, 0xff, 0xd4, 0xaf, 0xd4, 0xaf, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5f, 0xfe, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfa, 0xff, 0xff, 0x91, 0xff, 0xff, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x9e, 0x1f, 0xff, 0xff, 0xf8, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x97, 0xff, 0xfe, 0x7f, 0xf2, 0xff, 0xff, 0x9f, 0xe0, 0x00, 0x00, 0x07, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf8, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0x9f, 0xff, 0xfe, 0x7f, 0xd2, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x99, 0x99, 0x99, 0x99, 0x98, 0x19, 0x98, 0x3f, 0xff, 0x7e, 0x7f, 0xff, 0xf3, 0xff, 0x3e, 0x7f, 0xfe, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x3f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0x80, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x3f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x7f, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xd1, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x11, 0x8c, 0x31, 0x8c, 0x31, 0x88, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xc9, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x02, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x11, 0x8c, 0x31, 0x8c, 0x31, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xeb, 0x04, 0x03, 0x00, 0x00, 0xc0, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xc0, 0x03, 0xa4, 0x25, 0xc9, 0xe3, 0xf1, 0xfd, 0xff, 0xff, 0xbf, 0x5f, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xff, 0xff, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xff, 0xff, 0x14, 0x21, 0x84, 0x21, 0x84, 0x28, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xe3, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xaf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x80, 0x01, 0xf9, 0xff, 0xeb, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x59, 0xff, 0xff, 0xdf, 0xfd, 0x9e, 0x59, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xe3, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x79, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x79, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xa4, 0x25, 0xff, 0x9f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0x9f, 0xff, 0x9f, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x25, 0xf9, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf8, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x99, 0x99, 0x99, 0x99, 0x98, 0x19, 0x98, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0x8f, 0xe9, 0xf8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0x04, 0x00, 0x95, 0xf1, 0x02, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xfe, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0x7f, 0xff, 0x8f, 0xe9, 0xff, 0xfe, 0x07, 0x87, 0x87, 0x87, 0x87, 0x86, 0x07, 0x86, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xfb, 0x3f, 0x1f, 0xff, 0xff, 0xf8, 0xfc, 0xff, 0xff, 0xf9, 0xff, 0xfd, 0xbf, 0xff, 0x9f, 0x80, 0x43, 0xd5, 0xf1, 0xc0, 0x21, 0x43, 0xc3, 0xc3, 0xc3, 0xc3, 0xc2, 0x43, 0xc2, 0xff, 0xfe, 0x64, 0x22, 0x44, 0x22, 0x44, 0x26, 0x64, 0x46, 0xff, 0xfe, 0x22, 0x20, 0x00, 0x00, 0x04, 0x44, 0xff, 0xff, 0xf1, 0xff, 0xfa, 0x5f, 0xff, 0x8f, 0xff, 0x1d, 0xcd, 0xe9, 0xbf, 0x8f, 0x61, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0x61, 0xe0, 0xff, 0xfe, 0x64, 0x22, 0x44, 0x22, 0x44, 0x26, 0x64, 0x46, 0xff, 0xfe, 0x3c, 0x7f, 0xff, 0xff, 0xfe, 0x3c, 0xff, 0xff, 0xe0, 0x03, 0xfa, 0x5f, 0xc0, 0x07, 0xff, 0xfe, 0x95, 0xf1, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3f, 0xe3, 0xc7, 0xe3, 0xc7, 0xfc, 0x3f, 0xc4, 0xff, 0xff, 0x38, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xc0, 0x03, 0xf4, 0x2f, 0xc0, 0x03, 0xff, 0xfe, 0x8f, 0xe9, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xbf, 0xfd, 0x3f, 0xff, 0xa4, 0x3a, 0x7c, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xe7, 0xe7, 0x90, 0x03, 0xf5, 0xaf, 0xc0, 0x09, 0xff, 0xfe, 0x97, 0xf1, 0x7f, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xfa, 0xff, 0xff, 0x64, 0xff, 0xff, 0x2f, 0xff, 0xe6, 0x7e, 0x5e, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xe7, 0xe7, 0xa8, 0xab, 0xe9, 0x97, 0xd5, 0x15, 0xff, 0xff, 0x8f, 0xe9, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0xff, 0x26, 0x7f, 0xfe, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xd3, 0xd3, 0xd5, 0x53, 0xe9, 0x97, 0xca, 0xab, 0xff, 0xff, 0x97, 0xf1, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0x24, 0x3f, 0xfc, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xd3, 0xd3, 0xe8, 0x03, 0xd0, 0x0b, 0xc0, 0x17, 0xff, 0xff, 0x8f, 0xa9, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd3, 0xd3, 0xf5, 0xff, 0xd1, 0x8b, 0xff, 0xaf, 0xff, 0xff, 0x97, 0xb3, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0x46, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xb1, 0xb1, 0xf9, 0x7f, 0xa0, 0x05, 0xfe, 0x9f, 0xff, 0xff, 0x8f, 0xab, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xb1, 0xb1, 0xff, 0x7f, 0xbf, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0x97, 0xf1, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xfe, 0x7f, 0xc0, 0x03, 0xfe, 0x7f, 0xff, 0xff, 0x8f, 0xa9, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfe, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0x97, 0xf1, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0x0f, 0xe8, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0x15, 0xf0, 0xff, 0xff, 0x7f, 0xff, 0x80, 0xbf, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0x0f, 0xe9, 0xff, 0xff, 0x7f, 0xff, 0xa2, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x15, 0xf1, 0xff, 0xff, 0x7f, 0xff, 0x80, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x63, 0xff, 0xfc, 0xff, 0xff, 0xc6, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0x8d, 0xe8, 0xff, 0xff, 0x0f, 0xff, 0x80, 0xff, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0xff, 0x62, 0xff, 0xf4, 0xaf, 0xff, 0xc6, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0x9e, 0x79, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0x95, 0xf0, 0xff, 0xff, 0x2f, 0xff, 0x80, 0x8f, 0xff, 0xf4, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xce, 0x73, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0x0f, 0xe8, 0xff, 0xff, 0x0f, 0xff, 0xa2, 0x8f, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0xff, 0x24, 0xff, 0xd4, 0x27, 0xff, 0xa4, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xe6, 0x67, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x17, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0x80, 0x8d, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0xff, 0x64, 0xff, 0xfc, 0x25, 0xff, 0xe6, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xf2, 0x4f, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0xff, 0xff, 0xfe, 0x0f, 0xe8, 0x7f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0xff, 0x67, 0xff, 0xe4, 0x3f, 0xff, 0x26, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xfa, 0x5f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x3f, 0xff, 0x7f, 0xff, 0xfe, 0x17, 0xf0, 0x7f, 0xff, 0x0f, 0xff, 0xbf, 0x81, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0xff, 0x25, 0xff, 0xa4, 0x2b, 0xff, 0x24, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xfc, 0xbf, 0xfe, 0xff, 0xff, 0xfe, 0x0f, 0xe8, 0x7f, 0xff, 0x2f, 0xff, 0xff, 0xa5, 0xff, 0xf4, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0x7f, 0xfd, 0x3f, 0xff, 0x7f, 0xff, 0xfc, 0x17, 0xb0, 0x3f, 0xff, 0x0f, 0xff, 0xff, 0x81, 0xff, 0xf0, 0x7f, 0xfe, 0xff, 0xff, 0x63, 0xff, 0xf5, 0x2f, 0xff, 0x46, 0x7f, 0xfe, 0xff, 0xfe, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xe7, 0xe7, 0xfe, 0x7f, 0xfc, 0xbf, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xa8, 0x3f, 0xff, 0x7f, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x63, 0xff, 0xff, 0x3f, 0xff, 0xc6, 0x7f, 0xfe, 0xff, 0xf2, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xc3, 0xc3, 0xfe, 0x7f, 0xfd, 0x3f, 0xfe, 0x7f, 0xff, 0xfc, 0x17, 0xf0, 0x3f, 0xff, 0x7f, 0xff, 0xfc, 0xa5, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x3f, 0xfc, 0xff, 0xf3, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x00, 0x00, 0xfe, 0x7f, 0xfc, 0xbf, 0xfe, 0x7f, 0xff, 0xf8, 0x0f, 0xa8, 0x1f, 0xff, 0x7f, 0xff, 0xfc, 0x81, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xbf, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x7f, 0xfe, 0xfe, 0x7f, 0xfc, 0x3f, 0xfe, 0x7f, 0xff, 0xf0, 0x17, 0xf0, 0x0f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xfe, 0x67, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x7f, 0xfe, 0xff, 0xe6, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x01, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xfb, 0xd5, 0xfb, 0xfc, 0xfe, 0x7f, 0xfe, 0x7f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfb, 0xd6, 0xfb, 0xfb, 0x02, 0x40, 0x02, 0x40, 0xdf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xfb, 0xd5, 0xfb, 0xf4, 0x02, 0x40, 0x02, 0x40, 0x2f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfb, 0xd6, 0xfb, 0xe9, 0x02, 0x40, 0x02, 0x40, 0x17, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x3f, 0xf4, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x99, 0x99, 0x9f, 0xf9, 0x80, 0x01, 0xd5, 0xfb, 0xea, 0x02, 0x40, 0x02, 0x40, 0x17, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x99, 0x99, 0x9f, 0xf9, 0x80, 0x01, 0xd6, 0xfb, 0xd0, 0x02, 0x40, 0x02, 0x40, 0x0b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x67, 0x2f, 0xf4, 0xff, 0xff, 0x26, 0x7f, 0xe6, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xf0, 0xff, 0xff, 0xd5, 0xfb, 0xd0, 0x02, 0x40, 0x02, 0x40, 0x0b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x25, 0x3f, 0xfc, 0xbf, 0xfd, 0x24, 0x2f, 0xe4, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfb, 0xd6, 0xfb, 0xd0, 0x02, 0x40, 0x02, 0x40, 0x0b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xe3, 0xc7, 0xe3, 0xc7, 0xfc, 0x3c, 0x7c, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x99, 0x99, 0x9f, 0xf9, 0xd5, 0xfb, 0xd5, 0xfb, 0xd0, 0x02, 0x40, 0x02, 0x40, 0x0b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x64, 0x22, 0x44, 0x22, 0x44, 0x26, 0x64, 0x46, 0x7f, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x99, 0x99, 0x9f, 0xf9, 0xd6, 0xfb, 0xd6, 0xfb, 0xd0, 0x0e, 0x7f, 0xfe, 0x70, 0x0b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x64, 0x22, 0x44, 0x22, 0x44, 0x26, 0x64, 0x46, 0x7f, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xf0, 0xd5, 0xfb, 0xd5, 0xfb, 0xd0, 0x0f, 0xc0, 0x03, 0xf0, 0x0b, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xfa, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0x80, 0x01, 0xbf, 0xfc, 0x3f, 0xfc, 0x3f, 0xfd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0x3f, 0xff, 0xf8, 0x99, 0x99, 0x9f, 0xf9, 0x80, 0x01, 0x80, 0x01, 0xa0, 0x05, 0xff, 0xff, 0xa0, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x05, 0xff, 0xff, 0xa0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfd, 0xfe, 0xff, 0xbf, 0xfd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xff, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0b, 0xff, 0x7f, 0xd0, 0x0b, 0x07, 0x87, 0x87, 0x87, 0x87, 0x86, 0x07, 0x86, 0x7f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0b, 0xfe, 0x7f, 0xd0, 0x0b, 0x43, 0xc3, 0xc3, 0xc3, 0xc3, 0xc2, 0x43, 0xc2, 0x7f, 0xff, 0x64, 0x22, 0x44, 0x22, 0x44, 0x26, 0x65, 0xfe, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0xe7, 0xc7, 0xe3, 0xe7, 0xe7, 0xff, 0xff, 0xd0, 0x0b, 0xfc, 0x3f, 0xd8, 0x1b, 0x61, 0xe1, 0xe1, 0xe1, 0xe1, 0xe0, 0x61, 0xe0, 0x7f, 0xff, 0x64, 0x22, 0x44, 0x22, 0x44, 0x26, 0x67, 0xfe, 0x7f, 0xff, 0xe7, 0xe7, 0xe7, 0xe7, 0xc7, 0xe3, 0xc7, 0xe3, 0xd4, 0x23, 0xc7, 0xe3, 0xff, 0xff, 0xd0, 0x0b, 0xfd, 0xbf, 0xd8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x3f, 0xe3, 0xc7, 0xe3, 0xc7, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0xc7, 0xe3, 0xc7, 0xe3, 0xd4, 0x23, 0xd4, 0x23, 0xe8, 0x17, 0xd4, 0x2b, 0xff, 0xff, 0xd0, 0x0b, 0xfe, 0x7f, 0xd0, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xbf, 0xfd, 0x3f, 0xff, 0xa4, 0x2f, 0xfc, 0xff, 0xff, 0xd4, 0x2b, 0xd4, 0x23, 0xe8, 0x17, 0xe8, 0x17, 0xf0, 0x0f, 0xe8, 0x17, 0xff, 0xff, 0xd0, 0x0b, 0xfb, 0xdf, 0xd5, 0x5b, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xfa, 0xff, 0xff, 0x64, 0xff, 0xff, 0x2f, 0xff, 0xe6, 0x7f, 0xfe, 0xff, 0xff, 0xe8, 0x17, 0xe8, 0x17, 0xf8, 0x1f, 0xf8, 0x1f, 0xf1, 0x2f, 0xb2, 0x4d, 0xff, 0xff, 0xd0, 0x0b, 0xfc, 0x3f, 0xda, 0xab, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0xff, 0x26, 0x7f, 0xf6, 0xff, 0xff, 0xf8, 0x1f, 0xf8, 0x1f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xb2, 0x4d, 0xf3, 0xf3, 0xd0, 0x0b, 0xff, 0xff, 0xd0, 0x0b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0x24, 0x3f, 0xfc, 0xff, 0xff, 0xf2, 0x4f, 0xf1, 0x2f, 0xf1, 0x2f, 0xc9, 0x2b, 0x90, 0xc9, 0xd1, 0x8b, 0xe3, 0xf1, 0xd0, 0x0b, 0xfe, 0x7f, 0xd8, 0x1b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xc4, 0xff, 0xff, 0xf2, 0x4f, 0xf1, 0x2f, 0xc8, 0xcb, 0xc8, 0xcb, 0xf0, 0x1f, 0xf0, 0x0f, 0xea, 0x11, 0xd0, 0x0b, 0xff, 0x7f, 0xd8, 0x1b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x7e, 0x46, 0xff, 0xff, 0xc9, 0x93, 0xc8, 0xcb, 0xc8, 0x1b, 0xf8, 0x1f, 0xf0, 0x27, 0xf0, 0x0f, 0xf4, 0x0b, 0xd0, 0x0b, 0xfe, 0xff, 0xd0, 0x0b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7e, 0x46, 0xff, 0xff, 0xc8, 0x13, 0xc8, 0x1b, 0xfc, 0xff, 0xf8, 0x37, 0xe7, 0xf7, 0xf8, 0x1f, 0xf8, 0x07, 0xd0, 0x0b, 0xfe, 0x7f, 0xd0, 0x0b, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xfa, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0xf8, 0x1f, 0xf8, 0x2f, 0xfe, 0x4f, 0xf3, 0xe7, 0xff, 0xff, 0xf7, 0xef, 0xe9, 0x17, 0xbf, 0xfd, 0xff, 0xff, 0xbf, 0xfd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xff, 0xff, 0xf7, 0xef, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xc8, 0xe7, 0xa0, 0x05, 0xfd, 0xbf, 0xa0, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x05, 0xff, 0xff, 0xa0, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfc, 0x3f, 0xfc, 0x3f, 0xfd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xfd, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xff, 0xff, 0xd0, 0x0f, 0xc0, 0x03, 0xf0, 0x0b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x02, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xf1, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xe7, 0xe7, 0xf7, 0xef, 0xff, 0xff, 0xd0, 0x0e, 0x7f, 0xfe, 0x70, 0x0b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xff, 0xfd, 0x71, 0x15, 0x11, 0x15, 0x1b, 0x16, 0x76, 0x26, 0xff, 0xd1, 0xf7, 0xef, 0xf7, 0xef, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xd0, 0x02, 0x4c, 0xb2, 0x40, 0x0b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xfd, 0x71, 0x1b, 0x11, 0x1b, 0x15, 0x1e, 0x6a, 0x26, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xf4, 0x2f, 0xe7, 0xe7, 0xff, 0xff, 0xd0, 0x02, 0x41, 0x02, 0x40, 0x0b, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xff, 0xfd, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xe3, 0xe7, 0xe7, 0xe7, 0xe7, 0xf4, 0x2f, 0xf4, 0x2f, 0xe8, 0x17, 0xf4, 0x2f, 0xff, 0xff, 0xd0, 0x02, 0x40, 0x82, 0x40, 0x0b, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xff, 0xfe, 0x2d, 0x88, 0x8d, 0x88, 0x88, 0x8c, 0x25, 0x74, 0xff, 0xff, 0xf4, 0x2f, 0xf4, 0x2f, 0xe8, 0x17, 0xe8, 0x17, 0xf0, 0x0f, 0xe8, 0x17, 0xfb, 0xf7, 0xd0, 0x02, 0x41, 0x02, 0x40, 0x0b, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x6a, 0x88, 0x8a, 0x88, 0x8f, 0x8e, 0x66, 0xf6, 0xff, 0xff, 0xe8, 0x17, 0xe8, 0x17, 0xf8, 0x1f, 0xf8, 0x1f, 0xf1, 0x2f, 0xb2, 0x4d, 0xfb, 0xf7, 0xe8, 0x02, 0x40, 0x82, 0x40, 0x17, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xf8, 0x1f, 0xf8, 0x1f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xb2, 0x4d, 0xf3, 0xf3, 0xe8, 0x02, 0x41, 0x02, 0x40, 0x17, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x31, 0xff, 0xe3, 0xff, 0xff, 0x54, 0x38, 0xfc, 0xff, 0xff, 0xf2, 0x4f, 0xf1, 0x2f, 0xf1, 0x2f, 0xc9, 0x2b, 0x90, 0xc9, 0xd1, 0x8b, 0xf3, 0xf3, 0xf4, 0x02, 0x40, 0x82, 0x40, 0x2f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x3f, 0xfc, 0xff, 0xff, 0xf2, 0x4f, 0xf1, 0x2f, 0xc8, 0xcb, 0xc8, 0xcb, 0xf0, 0x1f, 0xf0, 0x0f, 0xfa, 0x17, 0xfb, 0x02, 0x4d, 0x32, 0x40, 0xdf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xc9, 0x93, 0xc8, 0xcb, 0xc8, 0x1b, 0xf8, 0x1f, 0xf0, 0x27, 0xf0, 0x0f, 0xf4, 0x0b, 0xfc, 0xfe, 0x7f, 0xfe, 0x7f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x63, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x7f, 0xfe, 0xff, 0xff, 0xc8, 0x13, 0xc8, 0x1b, 0xfc, 0xff, 0xf8, 0x37, 0xe7, 0xf7, 0xf8, 0x1f, 0xf8, 0x07, 0xff, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0xf8, 0x1f, 0xf8, 0x2f, 0xfe, 0x4f, 0xf3, 0xe7, 0xff, 0xff, 0xf7, 0xef, 0xe9, 0x17, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x3f, 0xfc, 0xff, 0xff, 0xf7, 0xef, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xc8, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x22, 0xbf, 0xff, 0xff, 0xff, 0xcc, 0x27, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0x4c, 0x32, 0x7f, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x23, 0x67, 0xfe, 0x7f, 0xff, 0xcc, 0x27, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x8f, 0xf1, 0xe7, 0x4c, 0x32, 0x7f, 0xff, 0xe7, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x7e, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf3, 0xcf, 0xf3, 0xc7, 0xe3, 0xcf, 0xf3, 0xff, 0xff, 0xe6, 0x70, 0x0e, 0x67, 0x4c, 0x32, 0x7f, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x71, 0xff, 0xf1, 0x2f, 0xff, 0xc6, 0x75, 0xfe, 0xff, 0xff, 0xcf, 0xf3, 0xcf, 0xf3, 0xc7, 0xe3, 0xc7, 0xe3, 0xf4, 0x2f, 0xc7, 0xe3, 0xff, 0xff, 0xfd, 0x8f, 0xf1, 0xbf, 0x4c, 0x32, 0x7f, 0xff, 0xdf, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xfc, 0x44, 0x3b, 0xfc, 0xff, 0xff, 0xc7, 0xe3, 0xc7, 0xe3, 0xf4, 0x2f, 0xf4, 0x2f, 0xf8, 0x1f, 0xf4, 0x2f, 0xff, 0xff, 0xfa, 0x78, 0x0e, 0x5f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xfc, 0xa9, 0xff, 0xfc, 0x3f, 0xf4, 0xff, 0xff, 0xf4, 0x2f, 0xf4, 0x2f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf0, 0x0f, 0xf8, 0x1f, 0xff, 0xff, 0xf5, 0xe0, 0x0f, 0xaf, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x76, 0xff, 0xa4, 0xdf, 0xff, 0x16, 0x6f, 0xfe, 0xff, 0xfd, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf1, 0x2f, 0xb2, 0x4d, 0xff, 0xff, 0xf5, 0xf8, 0x1f, 0xaf, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x6a, 0xff, 0xff, 0xff, 0xff, 0x16, 0x6f, 0xe6, 0xff, 0xff, 0xf8, 0x1f, 0xf8, 0x1f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xb2, 0x4d, 0xe7, 0xf9, 0xeb, 0xf8, 0x1f, 0xd7, 0xf8, 0x1f, 0x7f, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xf3, 0x67, 0xff, 0xfc, 0x3f, 0xe4, 0xff, 0xe3, 0xf2, 0x4f, 0xf1, 0x2f, 0xf1, 0x2f, 0xc9, 0x2b, 0x90, 0xc9, 0xd1, 0x8b, 0xe3, 0xf1, 0xeb, 0xfc, 0x3f, 0xd7, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x31, 0x3f, 0xfe, 0xbf, 0xff, 0xec, 0x2f, 0xfc, 0xff, 0xa3, 0xf2, 0x4f, 0xf1, 0x2f, 0xc8, 0xcb, 0xc8, 0xcb, 0xf0, 0x1f, 0xf0, 0x0f, 0xfa, 0x17, 0xeb, 0xfc, 0x3f, 0x57, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x71, 0xff, 0xfb, 0xef, 0xff, 0xd6, 0x7f, 0xf6, 0xff, 0xff, 0xc9, 0x93, 0xc8, 0xcb, 0xc8, 0x1b, 0xf8, 0x1f, 0xf0, 0x27, 0xf0, 0x0f, 0xfc, 0x0f, 0xd4, 0xfe, 0x7f, 0x6b, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0x7f, 0xf6, 0xff, 0xe9, 0xc8, 0x13, 0xc8, 0x1b, 0xfc, 0xff, 0xf8, 0x37, 0xe7, 0xf7, 0xf8, 0x1f, 0xf8, 0x07, 0xd4, 0x3e, 0x7c, 0x2b, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x22, 0x3f, 0xff, 0xff, 0xfd, 0x8c, 0x3f, 0xfc, 0xff, 0xe9, 0xf8, 0x1f, 0xf8, 0x2f, 0xfe, 0x4f, 0xf3, 0xe7, 0xff, 0xff, 0xf7, 0xef, 0xe9, 0x17, 0xd4, 0x0d, 0xb0, 0x2b, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xfc, 0x22, 0x27, 0xff, 0xff, 0xfa, 0x8c, 0x3f, 0xfc, 0xff, 0xbf, 0xf7, 0xef, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xc8, 0xe7, 0xd4, 0x02, 0x40, 0x2b, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x02, 0x40, 0x2b, 0xfe, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0d, 0xb0, 0x2b, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x2f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x3e, 0x7c, 0x2b, 0xb3, 0xcd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x2f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xfe, 0x7f, 0x2b, 0xb3, 0xcd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x67, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfb, 0xdf, 0xfb, 0xc3, 0xc3, 0xdf, 0xfb, 0xff, 0xff, 0xea, 0xfc, 0x3f, 0xd7, 0xb3, 0xcd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x67, 0xfe, 0xff, 0xff, 0xdf, 0xfb, 0xdf, 0xfb, 0xc3, 0xc3, 0xc3, 0xc3, 0xe4, 0x27, 0xc3, 0xc3, 0xff, 0xff, 0xeb, 0xfc, 0x3f, 0xd7, 0xb3, 0xcd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x34, 0x7f, 0xff, 0xff, 0xff, 0x8c, 0x27, 0xfc, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xe4, 0x27, 0xe4, 0x27, 0xf8, 0x1f, 0xe4, 0x27, 0xff, 0xff, 0xeb, 0xf8, 0x1f, 0xd7, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x34, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf4, 0xff, 0xff, 0xe4, 0x27, 0xe4, 0x27, 0xf8, 0x1f, 0xf8, 0x1f, 0xf0, 0x0f, 0xf8, 0x1f, 0xff, 0xff, 0xf5, 0xf8, 0x1f, 0xaf, 0x80, 0x01, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x8f, 0xff, 0xe6, 0x6f, 0xfe, 0xff, 0xff, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf1, 0x2f, 0xb2, 0x4d, 0xff, 0xff, 0xf5, 0xf0, 0x07, 0xaf, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x63, 0xff, 0xe3, 0xff, 0x8f, 0xfe, 0x7f, 0xe6, 0xbf, 0xff, 0xf8, 0x1f, 0xf8, 0x1f, 0xf1, 0x2f, 0xf1, 0x2f, 0xf1, 0x2f, 0xb2, 0x4d, 0xef, 0xfd, 0xfa, 0x70, 0x1e, 0x5f, 0xf8, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x22, 0xff, 0xa2, 0x29, 0x8e, 0x8c, 0x3f, 0xe4, 0xff, 0xff, 0xf2, 0x4f, 0xf1, 0x2f, 0xf1, 0x2f, 0xc9, 0x2b, 0x90, 0xc9, 0xd1, 0x8b, 0xe1, 0xe1, 0xfd, 0x8f, 0xf1, 0xbf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x97, 0xff, 0xf2, 0x4f, 0xf1, 0x2f, 0xc8, 0xcb, 0xc8, 0xcb, 0xf0, 0x1f, 0xf0, 0x0f, 0xf2, 0x13, 0xe6, 0x70, 0x0e, 0x67, 0xfc, 0x3f, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x6f, 0xf6, 0xff, 0xff, 0x71, 0x51, 0x11, 0xb1, 0x44, 0x6e, 0x66, 0xc6, 0xff, 0xff, 0xc9, 0x93, 0xc8, 0xcb, 0xc8, 0x1b, 0xf8, 0x1f, 0xf0, 0x27, 0xf0, 0x0f, 0xfc, 0x0f, 0xe7, 0x8f, 0xf1, 0xe7, 0xfc, 0x3f, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb9, 0xfd, 0xff, 0xff, 0x71, 0xb1, 0x11, 0x51, 0x44, 0x56, 0x65, 0x46, 0x89, 0xff, 0xc8, 0x13, 0xc8, 0x1b, 0xfc, 0xff, 0xf8, 0x37, 0xe7, 0xf7, 0xf8, 0x1f, 0xf8, 0x07, 0xff, 0xf0, 0x0f, 0xff, 0xfc, 0x3f, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb9, 0xfd, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x89, 0xff, 0xf8, 0x1f, 0xf8, 0x2f, 0xfe, 0x4f, 0xf3, 0xe7, 0xff, 0xff, 0xf7, 0xef, 0xe9, 0x17, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xf3, 0x3f, 0xff, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xff, 0xff, 0xf7, 0xef, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xc8, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xbf, 0xff, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xfc, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x02, 0xbf, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe7, 0x8f, 0xf1, 0xe7, 0xfc, 0x3f, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xbf, 0xff, 0x71, 0x15, 0x11, 0x15, 0x1b, 0x16, 0x62, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xe6, 0x70, 0x0e, 0x67, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xbf, 0xff, 0x71, 0x1b, 0x11, 0x1b, 0x15, 0x1e, 0x62, 0xfe, 0x97, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x7f, 0xf1, 0x8f, 0xfd, 0x8f, 0xf1, 0xbf, 0xfc, 0x3f, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xbf, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x97, 0xff, 0xfc, 0x3f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0x7f, 0xf5, 0xaf, 0xfa, 0x7f, 0xfe, 0x5f, 0xfc, 0x3f, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7f, 0xff, 0x2d, 0x88, 0x8d, 0x88, 0x88, 0x8c, 0x2b, 0xfc, 0xff, 0xff, 0xf0, 0x0f, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xff, 0xff, 0xfe, 0xff, 0xf2, 0x4f, 0xf5, 0x8f, 0xf1, 0xaf, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x6a, 0x88, 0x8a, 0x88, 0x8f, 0x8e, 0x77, 0xfe, 0x9f, 0xff, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xfc, 0x3f, 0xfe, 0xff, 0xfe, 0x7f, 0xf5, 0x07, 0xe0, 0xaf, 0xfc, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x0f, 0xff, 0x7f, 0xff, 0xff, 0xea, 0x07, 0xe0, 0x57, 0xf8, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x25, 0xff, 0xff, 0x1f, 0xff, 0xa4, 0x3f, 0xfc, 0xff, 0xff, 0xe0, 0x07, 0xec, 0x37, 0xec, 0x37, 0xec, 0x37, 0xe0, 0x07, 0xff, 0x7f, 0xff, 0xff, 0xea, 0x03, 0xc0, 0x57, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x3f, 0xfc, 0xff, 0xff, 0xec, 0x37, 0xec, 0x37, 0xec, 0x37, 0xec, 0x37, 0xe0, 0x07, 0xfe, 0xff, 0xff, 0xff, 0xea, 0x03, 0xc0, 0x57, 0xfc, 0x3f, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x6f, 0xf6, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xb6, 0xff, 0xff, 0xec, 0x37, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe0, 0x07, 0xfe, 0xff, 0xff, 0xff, 0xd7, 0x03, 0xc0, 0xeb, 0xfc, 0x3f, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb9, 0xfd, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x7f, 0x56, 0xff, 0xff, 0xf0, 0x0f, 0xed, 0xb7, 0xed, 0xb7, 0xed, 0xb7, 0xec, 0x37, 0xff, 0x7f, 0xff, 0xff, 0xd7, 0xc1, 0x81, 0xeb, 0xfc, 0x3f, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb9, 0xfd, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0xed, 0xb7, 0xef, 0xe7, 0xe7, 0xf7, 0xef, 0xf7, 0xd0, 0x0b, 0xff, 0x7f, 0xff, 0xff, 0xd7, 0xf9, 0x9f, 0xeb, 0xfc, 0x3f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xf3, 0xff, 0xff, 0x59, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x59, 0x9a, 0xff, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xcd, 0xb3, 0xfe, 0xff, 0xff, 0xff, 0xd7, 0xfe, 0x7f, 0xeb, 0xfc, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xd7, 0xfe, 0x7f, 0xeb, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xd7, 0xf9, 0x9f, 0xeb, 0xe0, 0x17, 0xe0, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xd7, 0xc1, 0x83, 0xeb, 0xc1, 0xfb, 0xc1, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x03, 0xc0, 0xeb, 0xfd, 0xbb, 0xfd, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x58, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf7, 0xef, 0xef, 0xf7, 0xef, 0xf7, 0xef, 0xf7, 0xff, 0xff, 0xf6, 0x6f, 0xff, 0xff, 0xea, 0x03, 0xc0, 0x57, 0x83, 0xbd, 0x83, 0xfd, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x58, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xef, 0xf7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xf4, 0x2f, 0xff, 0xff, 0xea, 0x03, 0xc0, 0x57, 0xfb, 0xbd, 0xfa, 0x4d, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe7, 0xe7, 0xe4, 0x27, 0xe4, 0x27, 0xe4, 0x27, 0xf7, 0xef, 0xf5, 0x2f, 0xff, 0xff, 0xea, 0x07, 0xe0, 0x57, 0xfb, 0xfd, 0xfa, 0x4d, 0x2a, 0xff, 0xff, 0xff, 0xff, 0x54, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe4, 0x27, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xef, 0xf7, 0xf8, 0x9f, 0xf2, 0x4f, 0xf5, 0x07, 0xe0, 0xaf, 0x82, 0xad, 0x83, 0xbd, 0x2d, 0xbf, 0xff, 0xff, 0xfd, 0xb4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf8, 0x1f, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe7, 0xe7, 0xe9, 0x17, 0xfe, 0x7f, 0xf5, 0x8f, 0xf1, 0xaf, 0x82, 0xad, 0x83, 0xbd, 0x2f, 0x1f, 0xff, 0xff, 0xf8, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe4, 0x27, 0xf4, 0xaf, 0xff, 0xff, 0xfa, 0x7f, 0xfe, 0x5f, 0x83, 0xfd, 0x82, 0x4d, 0x2e, 0x0f, 0xff, 0xff, 0xf0, 0x74, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe0, 0x07, 0xec, 0x37, 0xec, 0x37, 0xec, 0x37, 0xf8, 0x1f, 0xec, 0x37, 0xff, 0xff, 0xfd, 0x8f, 0xf1, 0xbf, 0x83, 0xbd, 0x82, 0x4d, 0x2f, 0x07, 0xff, 0xff, 0xe0, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xec, 0x37, 0xec, 0x37, 0xec, 0x37, 0xec, 0x37, 0xe0, 0x07, 0xeb, 0xd7, 0xff, 0xff, 0xe6, 0x70, 0x0e, 0x67, 0x83, 0xbd, 0x83, 0xfd, 0x2f, 0x83, 0xff, 0xff, 0xc1, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xec, 0x37, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xe0, 0x07, 0xfd, 0xbf, 0xff, 0xff, 0xe7, 0x8f, 0xf1, 0xe7, 0xc1, 0xbb, 0xc1, 0xfb, 0x2f, 0xc1, 0xff, 0xff, 0x83, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf0, 0x0f, 0xed, 0xb7, 0xed, 0xb7, 0xed, 0xb7, 0xec, 0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xc1, 0xfb, 0xc1, 0xfb, 0x2f, 0xe2, 0x00, 0x00, 0x47, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xed, 0xb7, 0xef, 0xe7, 0xe7, 0xf7, 0xef, 0xf7, 0xd0, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x17, 0xe0, 0x17, 0x2f, 0xf4, 0x00, 0x00, 0x2f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xcd, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xf8, 0xff, 0xff, 0x1f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xf9, 0x1f, 0xf8, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0x2f, 0xf9, 0x0f, 0xf0, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x38, 0x1c, 0x65, 0xf3, 0xcf, 0xf3, 0xcf, 0x2f, 0xf9, 0x07, 0xe0, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x38, 0x1c, 0x65, 0xef, 0xf7, 0xee, 0x77, 0x2f, 0xf9, 0x83, 0xc1, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf8, 0x1f, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xa6, 0x38, 0x1c, 0x65, 0xd3, 0xcb, 0xde, 0x7b, 0x2f, 0xf9, 0xc1, 0x83, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xf8, 0x1f, 0xff, 0xff, 0xed, 0xb7, 0xa6, 0x38, 0x1c, 0x65, 0xd1, 0x8b, 0xde, 0x7b, 0x2f, 0xf9, 0xe1, 0x87, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x07, 0xff, 0xff, 0xe0, 0x07, 0xa6, 0x38, 0x1c, 0x65, 0xb9, 0x9d, 0xbf, 0xfd, 0x2f, 0xf9, 0xf2, 0x4f, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xe0, 0x07, 0xff, 0xff, 0xe4, 0x27, 0xa6, 0x38, 0x1c, 0x65, 0xbe, 0x7d, 0xa2, 0x45, 0x2f, 0xf9, 0xfd, 0xbf, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xc0, 0x03, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xc0, 0x03, 0xf8, 0x1f, 0xdf, 0xfb, 0xa6, 0x38, 0x1c, 0x65, 0xbe, 0x7d, 0xa2, 0x45, 0x2f, 0xf9, 0xfd, 0xbf, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdf, 0xfb, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xc0, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x9d, 0xbf, 0xfd, 0x2f, 0xf9, 0xf2, 0x4f, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe0, 0x07, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0xe0, 0x07, 0xdf, 0xfb, 0x80, 0x00, 0x00, 0x01, 0xd1, 0x8b, 0xde, 0x7b, 0x2f, 0xf9, 0xe1, 0x87, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdf, 0xfb, 0xec, 0x37, 0xec, 0x37, 0xec, 0x37, 0xe0, 0x07, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0xfc, 0x3f, 0xff, 0xd3, 0xcb, 0xde, 0x7b, 0x2f, 0xf9, 0xc1, 0x83, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xec, 0x37, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xdf, 0xfb, 0xc0, 0x03, 0xc0, 0x03, 0xff, 0xf8, 0x1f, 0xff, 0xef, 0xf7, 0xee, 0x77, 0x2f, 0xf9, 0x83, 0xc1, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf0, 0x0f, 0xed, 0xb7, 0xed, 0xb7, 0xed, 0xb7, 0xec, 0x37, 0xc0, 0x03, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xf3, 0xcf, 0x2f, 0xf9, 0x07, 0xe0, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xed, 0xb7, 0xef, 0xe7, 0xe7, 0xf7, 0xef, 0xf7, 0xd0, 0x0b, 0xdf, 0xfb, 0xe0, 0x07, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0x2f, 0xf9, 0x0f, 0xf0, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xcd, 0xb3, 0xe0, 0x07, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xf9, 0x1f, 0xf8, 0x9f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x03, 0x2f, 0xf8, 0xff, 0xff, 0x1f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xbd, 0x2f, 0xf4, 0x00, 0x00, 0x2f, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x27, 0xd9, 0xc7, 0xe3, 0x9b, 0xff, 0xff, 0x40, 0x02, 0x2f, 0xe2, 0x00, 0x00, 0x47, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfa, 0x5f, 0xc2, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x25, 0xd9, 0xc7, 0xe3, 0x9b, 0xff, 0xff, 0x5c, 0x3a, 0x2f, 0xc1, 0xff, 0xff, 0x83, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfd, 0xfc, 0x3f, 0xff, 0xff, 0xa7, 0xe5, 0xd9, 0xc7, 0xe3, 0x9b, 0xc0, 0x03, 0x5f, 0xfa, 0x2f, 0x83, 0xff, 0xff, 0xc1, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0x9c, 0x39, 0xf8, 0x1f, 0xff, 0xff, 0xbf, 0xfd, 0xd9, 0xc7, 0xe3, 0x9b, 0xbf, 0xfd, 0x5f, 0xfa, 0x2f, 0x07, 0xff, 0xff, 0xe0, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0xff, 0x88, 0x11, 0x88, 0x11, 0xff, 0xff, 0xef, 0xf7, 0xd9, 0xc7, 0xe3, 0x9b, 0x55, 0x56, 0x5f, 0xfa, 0x2e, 0x0f, 0xff, 0xff, 0xf0, 0x74, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe0, 0x07, 0xe0, 0x07, 0xc2, 0x43, 0xa8, 0x15, 0xf0, 0x0f, 0xff, 0xff, 0xec, 0x37, 0xd9, 0xc7, 0xe3, 0x9b, 0x6a, 0xaa, 0x5f, 0xfa, 0x2f, 0x1f, 0xff, 0xff, 0xf8, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe0, 0x07, 0xe0, 0x07, 0xff, 0xff, 0x90, 0x09, 0xf6, 0x6f, 0xfc, 0x3f, 0xe0, 0x07, 0xd9, 0xc7, 0xe3, 0x9b, 0x40, 0x02, 0x5f, 0xfa, 0x2d, 0xbf, 0xff, 0xff, 0xfd, 0xb4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xec, 0x37, 0xec, 0x37, 0xfc, 0x3f, 0xf6, 0x6f, 0xd6, 0x6b, 0xc8, 0x13, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0x40, 0x02, 0x7d, 0xbe, 0x2a, 0xff, 0xff, 0xff, 0xff, 0x54, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xec, 0x37, 0xec, 0x37, 0xf0, 0x0f, 0xd6, 0x6b, 0xd0, 0x0b, 0xa8, 0x15, 0xe0, 0x07, 0x80, 0x00, 0x00, 0x01, 0x7d, 0xbe, 0x41, 0x82, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf0, 0x0f, 0xf0, 0x0f, 0xe0, 0x07, 0x90, 0x09, 0xed, 0xb7, 0x90, 0x09, 0xec, 0x37, 0xff, 0xfc, 0x3f, 0xff, 0x41, 0x82, 0x40, 0x02, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x58, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xed, 0xb7, 0xed, 0xb7, 0xe0, 0x07, 0xbd, 0xbd, 0xff, 0xff, 0xf0, 0x0f, 0xec, 0x37, 0xff, 0xf8, 0x1f, 0xff, 0x60, 0x06, 0x60, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x58, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe7, 0xe7, 0xe7, 0xe7, 0xe6, 0x67, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x6b, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x02, 0x40, 0x02, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xef, 0xf7, 0xef, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0b, 0xed, 0xb7, 0xff, 0xfc, 0x3f, 0xff, 0x7f, 0xfe, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xbf, 0xef, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
@@ -1,1353 +0,0 @@
-// v. 1.0.0 tilemap
-inline const int tilemapWidth = 320;
-inline const int tilemapHeight = 320;
-inline const int tilemapFlags = BLIT_2BPP;
-inline const uint8_t tilemap[25600] = {
-    0x00, 0x55, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00,
-    0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xc0, 0x03, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x30, 0x0f, 0xff, 0xc0, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0x0f, 0xff,
-    0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0xff,
-    0x3f, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0x0c, 0x03, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x33, 0xff, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0x0c, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x30, 0x33, 0xc0, 0x03, 0xcc, 0x30,
-    0x00, 0x00, 0x3c, 0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xc0, 0x03, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0c, 0xff, 0x00, 0x55, 0xaa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0x0c, 0xc3, 0xc3, 0x30, 0x0c, 0xc0, 0x03, 0x30, 0x0c, 0xc0, 0x03, 0x30, 0x33,
-    0x30, 0x0c, 0xcc, 0x30, 0xff, 0xff, 0x3c, 0xfc, 0xff, 0xcc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x03, 0x30,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xc0,
-    0x3f, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xfc, 0xf0, 0x0f, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0,
-    0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0x0c, 0x0f, 0xf0, 0x30, 0x0c, 0x0f, 0xf0, 0x30, 0x0c,
-    0x00, 0x00, 0x30, 0x30, 0xcc, 0x33, 0x0c, 0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xf0, 0x3f, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xfc, 0xc3, 0xc3, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0f, 0xf0, 0x30, 0x0c,
-    0x3c, 0x3c, 0x30, 0x0c, 0x00, 0x00, 0x30, 0x30, 0x33, 0xcc, 0x0c, 0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xcc, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x00, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x30, 0x3f,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xfc, 0xc3,
-    0xc3, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x0c,
-    0x03, 0xc0, 0x30, 0x0c, 0x33, 0xcc, 0x30, 0x0c, 0x00, 0x00, 0x30, 0x30, 0x0f, 0x30, 0x0c, 0x30, 0xff, 0xff, 0x3c,
-    0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x30, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xcc,
-    0x33, 0xff, 0xfc, 0xc3, 0xc3, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xfc,
-    0xfc, 0x3f, 0x3f, 0x0c, 0x03, 0xc0, 0x30, 0x0c, 0x33, 0xcc, 0x30, 0x0c, 0x00, 0x00, 0x30, 0x30, 0x0c, 0xf0, 0x0c,
-    0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xcc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x03,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xf3, 0xfc, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0x00, 0x55,
-    0xaa, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xfc, 0xc3, 0xc3, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xf3, 0xcf, 0xff, 0xf3, 0xfc, 0x3f, 0xcf, 0x0c, 0x00, 0x00, 0x30, 0x0c, 0x3c, 0x3c, 0x30, 0x0c, 0x00, 0x00, 0x30,
-    0x30, 0x33, 0xcc, 0x0c, 0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0x00,
-    0x30, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xc3, 0x0f, 0xfc, 0xfc, 0xfc, 0xcf, 0xff, 0xf3, 0x33, 0xff, 0xff, 0xfc,
-    0xc3, 0xff, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xfc, 0xf0, 0x0f, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0xff,
-    0xf0, 0x0f, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xc3, 0xfc, 0x3f, 0xc3, 0x0c, 0x03, 0xc0, 0x30, 0x0c, 0x0f, 0xf0, 0x30,
-    0x0c, 0x00, 0x00, 0x30, 0x30, 0xcc, 0x33, 0x0c, 0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xcc, 0x3f, 0xff, 0xc0, 0x03,
-    0xff, 0x03, 0x00, 0x00, 0xc0, 0xfc, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xc3, 0x0f, 0xf0, 0x30, 0x3f, 0x3f, 0xff, 0xf3,
-    0xcf, 0xff, 0xff, 0xcc, 0x3f, 0xff, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff,
-    0xf3, 0xcf, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xc3, 0xf0, 0x0f, 0xc3, 0x0c, 0xc3, 0xc3, 0x30,
-    0x0c, 0xc0, 0x03, 0x30, 0x0c, 0xc0, 0x03, 0x30, 0x33, 0x30, 0x0c, 0xcc, 0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xf0,
-    0x3f, 0xff, 0xc0, 0x03, 0xff, 0x0c, 0xc0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0xfc,
-    0x3c, 0xcf, 0xfc, 0xf3, 0xcf, 0x3f, 0xff, 0x30, 0x3f, 0xff, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x03, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xc3, 0xc3, 0x3f, 0xc0, 0xc0, 0x03, 0x03,
-    0x0c, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x30, 0x33, 0xc0, 0x03, 0xcc, 0x30, 0x00, 0x00,
-    0x3c, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0xf0, 0xc0, 0x00, 0x0f, 0xf0, 0xc3,
-    0xf0, 0x3f, 0xff, 0xcf, 0xff, 0x3f, 0xff, 0x33, 0xcc, 0xff, 0xfc, 0x03, 0x3f, 0xff, 0x00, 0x55, 0xaa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xf3, 0x3f, 0xfc, 0xcf,
-    0xf0, 0x03, 0xc0, 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x30, 0x00, 0x00,
-    0x0c, 0x33, 0xff, 0xff, 0xfc, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x03, 0xf3, 0x30,
-    0x00, 0x0f, 0xf0, 0xc3, 0xfc, 0xff, 0xfc, 0x00, 0xfc, 0x0f, 0xcf, 0x33, 0xcc, 0xf3, 0xfc, 0x0f, 0x3f, 0xff, 0x00,
-    0x55, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-    0xcc, 0xff, 0xff, 0x33, 0xfc, 0x0f, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0, 0x00, 0x00, 0xf0, 0x00,
-    0x00, 0x0f, 0xf0, 0xc3, 0x00, 0x0f, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x03, 0xff, 0x3f, 0xf3, 0x33, 0xcc, 0xcf, 0xff,
-    0xfc, 0x3f, 0xff, 0x00, 0x55, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xf3, 0xcf, 0xff, 0x33, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00,
-    0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xf0, 0x3f, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-    0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
-    0xcc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3c, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff,
-    0xff, 0xfc, 0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x3c, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff,
-    0xff, 0x33, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-    0xff, 0xf0, 0x30, 0x00, 0x00, 0x0c, 0xfc, 0xfc, 0xcc, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x33, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0x33, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0x30, 0x0c, 0xff,
-    0xff, 0x30, 0x0c, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x3c, 0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0xf0, 0xcf, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf,
-    0xff, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xf0, 0x0f, 0xff,
-    0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xcf, 0xf3, 0xf0, 0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xcc, 0x3f, 0xff,
-    0xc0, 0x03, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xc0, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xcc, 0x33,
-    0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xff, 0x0f, 0xf0,
-    0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0x03, 0xc0, 0xf0, 0x30, 0xcf, 0xf3, 0x3c, 0xfc,
-    0xfc, 0xf0, 0x3f, 0xff, 0xc0, 0x33, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0x3f, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xcc, 0x33,
-    0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33,
-    0xff, 0xff, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xc3, 0xc3, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xc0, 0x03, 0xf0, 0x30,
-    0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xcc, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xcc, 0x33,
-    0xff, 0xff, 0x33, 0xcc, 0xff, 0xfc, 0xc3, 0xc3, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcc, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xf0, 0x0f, 0xcc, 0x33, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f,
-    0xf0, 0x0f, 0xf0, 0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0x33, 0xcc, 0xff, 0xfc, 0xc3, 0xc3, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0x0f, 0xfc, 0x3f, 0xf0, 0x0f, 0xcc, 0x33, 0xf0, 0x0f,
-    0xff, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xcc, 0x3f, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xfc, 0x0f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf,
-    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0x0f, 0xff, 0xff, 0xf0, 0x0f,
-    0xc3, 0xc3, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xc0, 0x03, 0xf0, 0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xf0, 0x3f,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x0f, 0xf0, 0x3f, 0xf0, 0x3f, 0xfc,
-    0x0f, 0xff, 0xfc, 0xcf, 0xff, 0xff, 0xc3, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xcc,
-    0x33, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0x0f,
-    0xfc, 0x3f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0x03, 0xc0, 0xf0, 0x30, 0xcf, 0xf3, 0x3c,
-    0xfc, 0xfc, 0xcc, 0x3f, 0xff, 0x0c, 0x00, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0x0f, 0xf0,
-    0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0xfc, 0xcf, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcc, 0xff, 0x0f, 0xfc, 0x3f, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xcf, 0xf3, 0xf0,
-    0x30, 0xff, 0xff, 0x3c, 0xfc, 0xfc, 0xf0, 0x3f, 0xfc, 0x33, 0x00, 0x3f, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xfc, 0x0f,
-    0xff, 0xff, 0x03, 0xc0, 0xff, 0xf0, 0x03, 0xc0, 0x0f, 0xff, 0x3c, 0xcc, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfc, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0x0c, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0x30,
-    0x0c, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x3c, 0xfc, 0xfc, 0xcc, 0x3f, 0xfc, 0x0c, 0x30, 0x3f, 0xff, 0xf0, 0x3f,
-    0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0x03, 0xc0, 0xff, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xcc, 0xcc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0,
-    0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x33, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0x0c, 0x30, 0xff, 0xf3, 0xcc,
-    0xcc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xcc,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xcf,
-    0xf3, 0xff, 0xfc, 0xcc, 0xcc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3,
-    0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xcc, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc,
-    0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00,
-    0x0f, 0xf0, 0x00, 0x00, 0x0f, 0x3f, 0xff, 0xff, 0xfc, 0xf0, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0,
-    0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc0, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-    0xc0, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x03, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff,
-    0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0x30, 0x00, 0x00, 0x0c, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00,
-    0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0,
-    0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xff, 0xfc, 0xfc, 0x3f, 0x3f,
-    0xff, 0xf3, 0xcf, 0xff, 0xc0, 0xc3, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc3, 0x03, 0xcc, 0x00, 0x00,
-    0x33, 0xcc, 0x00, 0x00, 0x33, 0xcc, 0x00, 0x00, 0x33, 0xcc, 0x00, 0x00, 0x33, 0x33, 0xff, 0xff, 0xcc, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xc3, 0xff, 0xff, 0xc3, 0xc3,
-    0xff, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3c, 0xff,
-    0xf3, 0x03, 0xc0, 0xcf, 0xff, 0xf3, 0xcf, 0xff, 0xc0, 0xc3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xc3,
-    0x03, 0xcc, 0xc3, 0xc3, 0x33, 0xcc, 0xc0, 0x03, 0x33, 0xcc, 0xc0, 0x03, 0x33, 0xcc, 0xf0, 0x0f, 0x33, 0x33, 0x33,
-    0x33, 0xcc, 0xfc, 0xfc, 0xcc, 0x3f, 0xc3, 0x0c, 0x30, 0xc3, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xcc, 0x0f, 0xff, 0xc3,
-    0xff, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc3, 0x0f, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xc3, 0xc3, 0xff,
-    0xfc, 0xc3, 0xc3, 0x3f, 0xcc, 0x00, 0x0c, 0x33, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0xff, 0xcc, 0x0f, 0xf0, 0x33, 0xcc, 0x0f, 0xf0, 0x33, 0xcc, 0x00, 0x00, 0x33, 0xcc, 0xcc,
-    0x33, 0x33, 0x33, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff,
-    0xcc, 0x3f, 0xff, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x0f, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3,
-    0xff, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xcc, 0x00, 0x33, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x0f, 0xf0, 0x33, 0xcc, 0x3c, 0x3c, 0x33, 0xcc, 0x00,
-    0x00, 0x33, 0xcc, 0x33, 0xcc, 0x33, 0x33, 0x33, 0x33, 0xcc, 0xfc, 0xfc, 0xcc, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0xf0,
-    0x00, 0x00, 0x0f, 0xff, 0xcc, 0x3f, 0xff, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x0f, 0xff, 0xc3,
-    0xc3, 0xff, 0xff, 0xc3, 0xff, 0x00, 0x00, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xcc, 0x00, 0x0c, 0x33, 0xff, 0xcc, 0x33,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x03, 0xc0, 0x33, 0xcc, 0x33,
-    0xcc, 0x33, 0xcc, 0x00, 0x00, 0x33, 0xcc, 0x0f, 0x30, 0x33, 0x33, 0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xf0, 0x3f, 0xff,
-    0xfc, 0x3f, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xcc, 0x33, 0xff, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x03, 0xc0, 0xc3,
-    0xc3, 0x0f, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xc0, 0x03, 0xff, 0xfc, 0xc0, 0x03, 0x3f, 0xf3, 0x00, 0x00,
-    0xcf, 0xff, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x03,
-    0xc0, 0x33, 0xcc, 0x33, 0xcc, 0x33, 0xcc, 0x00, 0x00, 0x33, 0xcc, 0x0c, 0xf0, 0x33, 0x33, 0x33, 0x33, 0xcc, 0xfc,
-    0xfc, 0xcc, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x33, 0xff, 0xc3, 0x00, 0x00, 0xc3,
-    0xc3, 0x0f, 0xf0, 0xc3, 0xc3, 0x0f, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x30, 0x0c,
-    0xff, 0xfc, 0xc0, 0x03, 0x3f, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcc, 0x00, 0x00, 0x33, 0xcc, 0x3c, 0x3c, 0x33, 0xcc, 0x00, 0x00, 0x33, 0xcc, 0x33, 0xcc, 0x33, 0x33,
-    0xcc, 0xcc, 0xcc, 0xfc, 0xfc, 0xf0, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xfc, 0x0f, 0xff,
-    0xc3, 0x00, 0x3c, 0xc3, 0xc3, 0x0f, 0xf0, 0xc3, 0xc3, 0x0f, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x03, 0xc0, 0x33, 0xcc, 0x0f, 0xf0, 0x33, 0xcc, 0x00, 0x00, 0x33, 0xcc,
-    0xcc, 0x33, 0x33, 0x33, 0x33, 0x33, 0xcc, 0xfc, 0xfc, 0xcc, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xc3, 0x00, 0xfc, 0xc3, 0xc3, 0x03, 0xc0, 0xc3, 0xc3, 0x03, 0xff, 0xc3, 0xc3, 0xff, 0xff,
-    0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xc3, 0xc3, 0x33, 0xcc, 0xc0, 0x03, 0x33, 0xcc,
-    0xc0, 0x03, 0x33, 0xcc, 0xf0, 0x0f, 0x33, 0x33, 0xcc, 0xcc, 0xcc, 0xfc, 0xff, 0xf0, 0x3f, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xc3, 0x00, 0x3c, 0xc3, 0xc3, 0x03, 0xc0, 0xc3, 0xc3, 0x0f, 0xff,
-    0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xc0,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x33, 0xcc,
-    0x00, 0x00, 0x33, 0xcc, 0x00, 0x00, 0x33, 0xcc, 0x00, 0x00, 0x33, 0x33, 0xff, 0xff, 0xcc, 0xfc, 0xfc, 0xcc, 0x3f,
-    0xff, 0xfc, 0x3f, 0xff, 0xf0, 0x3c, 0x3f, 0x3f, 0xff, 0xfc, 0x0f, 0xff, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x00, 0x00,
-    0xc3, 0xc3, 0x0f, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0x30, 0x00, 0x00, 0x0c,
-    0xff, 0x3f, 0xf0, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xc0, 0x0c, 0x3c, 0x0f, 0xff, 0xf0, 0x0f, 0xff, 0xc3, 0x00, 0x00,
-    0xc3, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x0f, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf0, 0x03,
-    0xff, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x0f, 0x33, 0xc3, 0xc3, 0x33, 0x33, 0xc3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0xfc, 0x3f,
-    0x3f, 0xff, 0x00, 0x00, 0x3f, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x00, 0x00, 0xc3, 0xc3, 0x0c, 0xcc, 0xc3, 0xc3, 0xcc,
-    0xcc, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xf0, 0x00, 0x00, 0x0f,
-    0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0xc0, 0x03, 0x0f, 0xc0, 0x00, 0x00,
-    0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00,
-    0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3c, 0x3f, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f,
-    0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xc0, 0x00, 0x00,
-    0x03, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xcc, 0xff, 0xff, 0x33, 0xcc, 0xff, 0xff, 0x33, 0xcc, 0xff, 0xff, 0x33, 0xcc, 0xff, 0xff,
-    0x33, 0xc0, 0x3c, 0x00, 0x03, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00,
-    0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0xfc, 0x3f, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff,
-    0xf3, 0xcf, 0xcf, 0xf3, 0xf3, 0xf0, 0x3c, 0x00, 0x0f, 0x30, 0x0f, 0x00, 0x0c, 0x30, 0x00, 0xf0, 0x0c, 0x30, 0x03,
-    0xc0, 0x0c, 0x30, 0x03, 0xc0, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x03, 0xc0, 0x0c, 0xc3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x3f,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xcf, 0xf0, 0x0f, 0xf3, 0xcf, 0xf0, 0x0f,
-    0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0x03, 0xc0, 0xf3, 0xc0, 0x00, 0x00, 0x03, 0x30, 0x3f, 0xff, 0x0c, 0x30, 0xff,
-    0xfc, 0x0c, 0x30, 0x0f, 0xf0, 0x0c, 0x30, 0x03, 0xc0, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x03, 0xc0, 0x0c, 0xc3,
-    0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff,
-    0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xcf, 0xf0, 0x0f,
-    0xf3, 0xcf, 0xc3, 0xc3, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xc0, 0x03, 0xf3, 0xcc, 0x00, 0x00, 0x03, 0x30, 0xff,
-    0xff, 0x0c, 0x30, 0xff, 0xff, 0x0c, 0x30, 0x3f, 0xfc, 0x0c, 0x30, 0x3f, 0xfc, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30,
-    0x03, 0xc0, 0x0c, 0xc3, 0x3f, 0xff, 0xf3, 0xcf, 0xff, 0xfc, 0xc3, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f,
-    0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xfc, 0x3f, 0xf3, 0xcf, 0xcc, 0x33, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xf0, 0x0f, 0xf3, 0xc3, 0x00,
-    0x00, 0x33, 0x30, 0x3f, 0xff, 0x0c, 0x30, 0xff, 0xfc, 0x0c, 0x30, 0x03, 0xc0, 0x0c, 0x30, 0x0f, 0xf0, 0x0c, 0x30,
-    0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0xc3, 0x30, 0x00, 0x33, 0xcc, 0x00, 0x0c, 0xc3, 0xf0, 0xff, 0xff, 0x0f,
-    0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xcf, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfc, 0x3f, 0xf3, 0xcf, 0xcc, 0x33, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xf0,
-    0x0f, 0xf3, 0xcc, 0x00, 0x00, 0xc3, 0x30, 0x0f, 0x00, 0x0c, 0x30, 0x00, 0xf0, 0x0c, 0x30, 0x03, 0xc0, 0x0c, 0x30,
-    0x03, 0xc0, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x03, 0xc0, 0x0c, 0xc3, 0x30, 0x00, 0x03, 0xc0, 0x00, 0x0c, 0xc3,
-    0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xf3, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xc3, 0xc3, 0xf3, 0xcf, 0xff,
-    0xff, 0xf3, 0xcf, 0xc0, 0x03, 0xf3, 0xc0, 0x00, 0x00, 0x33, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30,
-    0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0xc3, 0x30, 0x00, 0xf3,
-    0xcf, 0x00, 0x0c, 0xc3, 0xf0, 0xc0, 0x03, 0x0f, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfc, 0x3f, 0xf3, 0xcf, 0xf0,
-    0x0f, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0x03, 0xc0, 0xf3, 0xc0, 0x00, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0xc3, 0x30, 0x03, 0xf3, 0xcf, 0xc0, 0x0c, 0xc3, 0xf0, 0xff, 0xff, 0x0f, 0xf3, 0x3f, 0xfc, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfc,
-    0x3f, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xcf, 0xf3, 0xf3, 0xf0, 0x00, 0x03, 0xcf, 0xc0,
-    0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03,
-    0xc0, 0x00, 0x00, 0x03, 0xc3, 0x30, 0x00, 0xf3, 0xcf, 0x00, 0x0c, 0xc3, 0xf0, 0xff, 0xff, 0x0f, 0xf3, 0x3f, 0xfc,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcc, 0xff, 0xff, 0x33, 0xcc, 0xff, 0xff, 0x33, 0xcc, 0xff, 0xff, 0x33, 0xcc, 0xff, 0xff, 0x33, 0xc3,
-    0x00, 0x33, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x30, 0x00, 0x03, 0xc0, 0x00, 0x0c, 0xc3, 0xf0, 0xc0, 0x03,
-    0x0f, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0xcf,
-    0xff, 0xff, 0xf3, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xc3, 0x30, 0x00, 0x33, 0xcc, 0x00, 0x0c,
-    0xc3, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0,
-    0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0xc0, 0x03, 0x0f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xc3, 0x3f, 0xff,
-    0xf3, 0xcf, 0xff, 0xfc, 0xc3, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xc3, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0xc3, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xc3, 0xff, 0xfc, 0x3c, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30,
-    0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xc0, 0x03,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0xc0,
-    0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-    0x30, 0x00, 0x00, 0x0c, 0x30, 0xf3, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xc0, 0x03,
-    0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xf0, 0x3c, 0x00, 0x03, 0xc3, 0xc0, 0x00,
-    0x0f, 0x00, 0x0f, 0x3f, 0x33, 0xff, 0xff, 0xcc, 0x30, 0x3c, 0xff, 0xfc, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x03,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xc3,
-    0xc0, 0x03, 0xc3, 0xf0, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0x0f, 0xf3, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x33, 0xff, 0xff, 0xcc, 0x3c, 0x0f, 0x3f, 0xfc, 0xff, 0x00, 0x00,
-    0x0f, 0xf0, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xf3,
-    0xc0, 0x03, 0xcf, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xff,
-    0xf3, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0xf0, 0x00, 0xcf, 0x33, 0xff, 0xff, 0xcc, 0x3f, 0x03, 0xcf,
-    0xfc, 0xfc, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0xf0, 0xc0, 0x03, 0x0f, 0xff,
-    0x30, 0x0c, 0xff, 0xf3, 0x3f, 0xfc, 0xcf, 0xf0, 0xfc, 0x3f, 0x0f, 0xf0, 0xfc, 0x3f, 0x0c, 0x30, 0xfc, 0x3f, 0x0c,
-    0x30, 0xfc, 0x3f, 0x0f, 0xcc, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x33, 0x33, 0xff, 0xff,
-    0xcc, 0x3f, 0xc0, 0xf3, 0xfc, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x03, 0xff, 0xfc, 0x00,
-    0x00, 0x3f, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xc3, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0xf0,
-    0xff, 0xff, 0x0f, 0xf3, 0x3f, 0xfc, 0xcf, 0xf3, 0x3f, 0x00, 0xcf, 0xf0, 0xcf, 0xf3, 0x0f, 0xf0, 0xcf, 0xf3, 0x0f,
-    0xf0, 0xcf, 0xf3, 0x0f, 0xf0, 0xcf, 0xf3, 0x0f, 0xcc, 0xf0, 0x00, 0x00, 0x33, 0x00, 0x00, 0x30, 0x00, 0x00, 0x0f,
-    0x33, 0x33, 0xff, 0xff, 0xcc, 0x33, 0xf0, 0x3c, 0xfc, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xc0,
-    0x03, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xf0, 0xf0, 0x00, 0x0f, 0xff, 0x3c, 0x00, 0xff, 0xc3, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xc3, 0xf0, 0xff, 0xff, 0x0f, 0xf3, 0x3f, 0xfc, 0xcf, 0xf3, 0xcf, 0x03, 0xcf, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0x3f, 0xfc, 0x3f, 0xff, 0x3f, 0xfc, 0x3f, 0xff, 0xcc, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00,
-    0xcc, 0x00, 0x00, 0x03, 0x33, 0x33, 0xff, 0xff, 0xcc, 0x30, 0xfc, 0x0f, 0x3c, 0xfc, 0x00, 0x00, 0x0f, 0xf0, 0x00,
-    0x00, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x00, 0xff, 0xf0, 0xf0, 0x00, 0x0f, 0xff, 0x3c, 0x00, 0xff, 0xc3,
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0xf0, 0xc0, 0x03, 0x0f, 0xff, 0x30, 0x0c, 0xff, 0xfc, 0xf3, 0x0f, 0x3f,
-    0xff, 0x3c, 0x3c, 0xff, 0xff, 0x3c, 0x3f, 0xf3, 0xff, 0x3c, 0x3f, 0xf3, 0xff, 0x3c, 0x3f, 0xff, 0xcc, 0x00, 0xc0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x33, 0x33, 0xff, 0xff, 0xcc, 0x3c, 0x3f, 0x03, 0xcc, 0xff, 0x00,
-    0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0xff,
-    0xc3, 0xcc, 0xff, 0xc3, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f,
-    0xff, 0x3c, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xf0, 0x33, 0xff, 0xff, 0xcc, 0x3f, 0x0f,
-    0xc0, 0xfc, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xf0,
-    0x00, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc3, 0xf0, 0xff, 0xff, 0x0f,
-    0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xf3, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x33, 0xff,
-    0xff, 0xcc, 0x3f, 0xc3, 0xf0, 0x3c, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xfc, 0x03, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3,
-    0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x33, 0x33, 0xff, 0xff, 0xcc, 0x3f, 0xf0, 0xfc, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0f, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xc3, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x30, 0x00, 0x00, 0x0c, 0x3f, 0xfc, 0x3f, 0x0c, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc3, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc3, 0x0f, 0x33, 0x33, 0x33, 0x33, 0x30, 0xc3, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0c, 0xcc, 0xcc, 0xcc, 0xcc, 0xf0, 0xc3, 0xf0, 0xff, 0xff,
-    0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xc0,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0,
-    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff,
-    0xfc, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0x03, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xc0, 0x33, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xc0, 0x03, 0x0f, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x0c, 0x00, 0x00, 0x30,
-    0x3c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xff, 0xff, 0x0f, 0xf3, 0x3f, 0xfc, 0xcf, 0xff, 0xf3,
-    0xcf, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xcc,
-    0x03, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xff, 0xff, 0x0f, 0xf3, 0x3f,
-    0xfc, 0xcf, 0xff, 0xcc, 0x33, 0xff, 0xc3, 0xc0, 0x03, 0xc3, 0xc3, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
-    0xc0, 0x03, 0xc3, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x33, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc0,
-    0x03, 0x0f, 0xff, 0x30, 0x0c, 0xff, 0xff, 0x33, 0xcc, 0xff, 0xcf, 0xf0, 0x0f, 0xf3, 0xcf, 0xf0, 0x0f, 0xf0, 0x0f,
-    0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf3, 0xcc, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0x33, 0xcc, 0xff, 0xfc, 0x3c, 0x3c, 0x3f, 0xfc,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0xcc, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x33, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0x33, 0xc3, 0xcf, 0xff, 0xff, 0xf3, 0xc3, 0xff, 0xff, 0xff, 0xf3, 0xcc, 0x3f, 0xf3,
-    0xc3, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0x33, 0x0c, 0xff, 0xf0,
-    0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0x0f, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x33, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xc3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff,
-    0x30, 0xcc, 0xff, 0xff, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff,
-    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x33, 0x0c, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0,
-    0x0f, 0xf0, 0x0f, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x33, 0x0f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xfc,
-    0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xcc, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
-    0x33, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x33, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x30, 0xc0,
-    0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x03, 0x00, 0x33, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x0c, 0x00, 0x00, 0xc0, 0x33, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x03, 0x00, 0x33, 0x0f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x33, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3c,
-    0x3f, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0xc3, 0xc3, 0xcf, 0xf3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcf, 0xcc, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xff, 0x30, 0x0c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x33, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x33, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0x0f, 0xf3, 0x3f, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0x0f, 0xf3, 0x3f, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0xf0, 0xf0, 0x0f, 0x0f,
-    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x33, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xf0,
-    0x3f, 0x33, 0xcc, 0xf3, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xcf, 0x33, 0x0f, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x33, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xcc, 0xfc, 0x0f, 0x33, 0xcc, 0xf3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xcf, 0x33, 0xcc,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x33, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0xf0, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
-    0xf0, 0xf0, 0xf0, 0xcc, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x0f, 0x00, 0x33, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x30, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0c, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xcc, 0xc0, 0xf0, 0x00, 0x33, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x33,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0c, 0x3f, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xcc, 0x00, 0x00, 0x33, 0xcc,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xcc, 0xf0, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xc0, 0x33, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xf3, 0x0f, 0xf3, 0x0f, 0xf3,
-    0xc3, 0xc3, 0xcf, 0xf3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcf, 0xf3, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0xc0, 0x00, 0x03, 0xc0, 0xcf, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x33, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xf3,
-    0x0f, 0xf3, 0x0f, 0xfc, 0x3c, 0x3c, 0x3f, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f,
-    0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xfc,
-    0x3f, 0xfc, 0x3f, 0xcf, 0x03, 0xcf, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x03, 0xc3, 0xc0, 0x00, 0x00, 0x3c, 0x0f, 0x3f, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xcf, 0x03, 0xcf, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x3f, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xfc, 0x03, 0xf0, 0x0f, 0xf0, 0x0f, 0x3f, 0x00, 0x3f, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0f, 0xfc, 0x3c, 0x3f, 0xff, 0xff, 0xc3, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x00, 0x00, 0x00, 0x0f, 0xfc, 0x30, 0x30, 0x00, 0x00, 0x30, 0x0c, 0x0f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcf, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0xc3, 0x0f, 0xff, 0xff,
-    0xff, 0xf3, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-    0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x0c, 0x00, 0x00, 0x0c, 0x0c,
-    0x3f, 0xf0, 0x00, 0x00, 0x00, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3c, 0x3c, 0x3f, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0x0f, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x30, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf0, 0xcc, 0xcf, 0xf3, 0xfc, 0xf3, 0x33, 0xcc, 0xfc,
-    0xf3, 0x33, 0xcc, 0xfc, 0xf3, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xf3, 0xff, 0xff, 0xcf,
-    0x3c, 0xff, 0xf3, 0xcf, 0x3c, 0xff, 0xf3, 0xcf, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xcc, 0xff, 0xff, 0xff, 0xf3, 0x30, 0xcc, 0xff, 0xf3, 0x30, 0xcc, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x33, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x03,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xc3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xc3, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xf3, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc0, 0x03, 0xc3, 0xc3, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x0f, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xff, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0x0f, 0xff,
-    0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0x3f,
-    0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xf3, 0x03, 0xfc, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x03, 0x03, 0xc0, 0xf0, 0x0f, 0x03, 0xc0, 0xf0, 0x0f, 0x03, 0xc0, 0xc0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xf0, 0xc3, 0xfc, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x03, 0x03, 0xc0, 0xf0, 0x0f, 0x03, 0xc0, 0xf0,
-    0x0f, 0x03, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x03, 0xfc,
-    0xcf, 0x00, 0x30, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xcc, 0x30, 0x0c,
-    0x33, 0xf0, 0xc3, 0xfc, 0x0f, 0xff, 0x03, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x33, 0xff, 0x33, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xff, 0xff,
-    0x03, 0x30, 0x0c, 0x03, 0xc0, 0x30, 0x0c, 0x03, 0xc0, 0x30, 0x0c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xcc, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xf0, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x33, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf3, 0xc3, 0xfc,
-    0x33, 0xc3, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc3, 0xfc, 0x3f, 0xc3, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xcc, 0x30, 0x0c, 0x33, 0xff, 0xff, 0xc3, 0xff, 0xfc, 0x0f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff,
-    0xc3, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcc, 0x30, 0x0c, 0x33, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff,
-    0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x03, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc0, 0x03, 0xc3, 0xc3, 0xc0, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00,
-    0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff,
-    0xc0, 0xff, 0xfc, 0xc3, 0xff, 0xc0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfc, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x00, 0x30, 0x00, 0x00, 0xc3, 0x33, 0xff, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0x33, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xfc, 0xc3, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xc0,
-    0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3c, 0x00, 0x3f, 0xc0, 0x3c, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xcf, 0x0f,
-    0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff,
-    0xff, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xc0, 0x00, 0x30, 0x0f, 0xf3, 0x33, 0xff, 0x03, 0xf0, 0x00, 0x0c,
-    0x03, 0x30, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0c, 0x30, 0x0f, 0xf0, 0x0c, 0xff, 0xff,
-    0xff, 0xfc, 0x3c, 0x30, 0x0c, 0x0c, 0x30, 0x30, 0x0c, 0x0c, 0x30, 0x30, 0x0c, 0x3c, 0x3c, 0x30, 0x30, 0x3c, 0xff,
-    0xff, 0xff, 0xfc, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x03, 0xff, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x03, 0xf3, 0xf0, 0xf3, 0xfc,
-    0xc3, 0xcf, 0xff, 0xc0, 0xff, 0x3c, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x00, 0x3c, 0x03,
-    0xfc, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x30, 0x0c, 0x0c, 0x30, 0x30, 0x0c, 0x0c, 0x30, 0x30, 0x0c, 0x3c, 0x3c,
-    0x30, 0x30, 0x3c, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xcc, 0x33, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,
-    0xfc, 0xc3, 0x33, 0xff, 0x03, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xfc, 0x0f, 0xf0, 0x3f, 0xfc, 0x0f, 0xf0,
-    0x3f, 0xff, 0xf0, 0x0f, 0xff, 0xf0, 0x30, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x30, 0x0c, 0xff, 0xf0, 0x00, 0x00,
-    0x0f, 0xff, 0xff, 0xff, 0xfc, 0xc0, 0xff, 0xfc, 0xc3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x30, 0xcf, 0xff, 0xff,
-    0xf3, 0x0f, 0xff, 0xff, 0xff, 0xcc, 0x30, 0x0f, 0xcc, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x03, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf0, 0xfc, 0x3f, 0xfc, 0x3f, 0xc3, 0x00, 0x00, 0x0f, 0xff, 0x33, 0xcc,
-    0xff, 0xf0, 0x00, 0x00, 0xc3, 0xff, 0xff, 0xff, 0xfc, 0xc3, 0x3f, 0xff, 0x03, 0x3f, 0xff, 0xff, 0xff, 0x33, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0x3c,
-    0x30, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3f, 0xfc, 0x33, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0x0c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x30, 0xfc, 0x3f, 0xfc, 0x3f, 0xcc, 0xc0, 0xcc,
-    0xcf, 0xfc, 0xc3, 0xc3, 0x3f, 0xf3, 0x33, 0x03, 0x33, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xfc, 0xc3, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x3c, 0x3f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0xf3, 0x0f, 0xf3,
-    0x0f, 0xf3, 0x33, 0x33, 0x0f, 0xfc, 0xc3, 0xc3, 0x3f, 0xf0, 0xcc, 0xcc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x3f,
-    0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x30,
-    0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0xf3, 0x0f, 0xf3, 0x0f, 0xfc, 0xc0, 0x00, 0x0f, 0xf3, 0x00, 0x00, 0xcf, 0xf0, 0x00, 0x03, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0xff, 0xcc, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xf3, 0x0f, 0xf3, 0x0f, 0xff, 0x33, 0xff, 0xff, 0xf3, 0x03, 0xc0, 0xcf, 0xff, 0xff,
-    0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x3f, 0xcf, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x0f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcf, 0x03, 0xcf, 0x03, 0xff, 0xc3, 0x3f, 0xff, 0xcc, 0x00,
-    0x00, 0x33, 0xff, 0xfc, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xcc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0x3c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcf, 0x03, 0xcf, 0x03, 0xff, 0xff,
-    0x3f, 0xff, 0xcf, 0xff, 0xff, 0xf3, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x3f, 0xff, 0x03, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0x0c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x30, 0x0f, 0xff, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xfc, 0x3f, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xff, 0xcc, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc3, 0x3f, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xfc, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
-    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x33, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xfc, 0xc3,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xcc, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x30, 0x0f, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x03, 0x33, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0xf3, 0xfc, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x0c, 0xff, 0xff, 0xff, 0x30,
-    0xcc, 0xff, 0xff, 0xff, 0xf0, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xc3,
-    0xfc, 0x3f, 0xc3, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x33, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff,
-    0xff, 0xc0, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x30, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f,
-    0xff, 0xff, 0xff, 0xf0, 0xfc, 0x3f, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xfc, 0xc0, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0xff, 0xff, 0xff, 0xcc, 0x0c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0x0c, 0x30, 0xff, 0xff, 0xf3, 0x30, 0x0c, 0x3f, 0xff, 0xff, 0xcc, 0x30, 0x0f, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x3f, 0xff,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xc0, 0xf3, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x30, 0xff, 0xff, 0xff, 0xf0, 0x0c, 0x33, 0xff, 0xff, 0xfc, 0x3c, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x00, 0xff, 0xfc, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0x30, 0x0f, 0xff, 0xff,
-    0xff, 0x0c, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x33, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0f, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x03, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xcf, 0xff,
-    0xc0, 0x03, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x33, 0xff, 0xff, 0xcc,
-    0x30, 0x0c, 0xcf, 0xff, 0xff, 0x0c, 0x30, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf0, 0xcf,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xfc, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0x0c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0xff, 0x30, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xf3, 0x0f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0x3f, 0xcf, 0x00, 0x0f, 0xff,
-    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0x3c, 0x0f, 0xff, 0xff, 0xff, 0x33, 0x0c, 0xff, 0xff, 0xff, 0x30, 0x3c, 0x3f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xfc, 0x3f, 0xfc,
-    0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff,
-    0xcc, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x3c,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x0c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf3, 0x0f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x03, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcc, 0x33, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x30, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xcc, 0xc0, 0x03, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf0,
-    0x0f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc,
-    0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc,
-    0x3c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3f, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf0, 0x0f,
-    0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x30, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x33, 0xff, 0xcf, 0xf3,
-    0x33, 0xff, 0xcf, 0xff, 0xf0, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x0f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x3c, 0xff, 0xcf, 0xf3, 0x3c, 0xff, 0xcf, 0xff, 0xcf, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0xf3, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0x3c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x33, 0xff, 0xcf, 0xf3, 0x33, 0xff, 0xcf, 0xff, 0x30, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c,
-    0x30, 0x00, 0x0c, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3c, 0xff, 0xcf, 0xf3, 0x3c, 0xff, 0xcf, 0xfc, 0xc3, 0x00, 0x0c,
-    0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x03, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xcc, 0x30, 0x0f, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc0, 0x00, 0x00, 0x03, 0xf3, 0x33, 0xff, 0xcf,
-    0xfc, 0xcc, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x03, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc0, 0x00, 0x00, 0x03,
-    0xf3, 0x3c, 0xff, 0xcf, 0xf3, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0xcf, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3f,
-    0x0c, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x3c, 0x3f, 0xff, 0xfc, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x0f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x33, 0xff, 0xcf, 0xf3, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00,
-    0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0x0c, 0x33, 0x0f, 0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0xf3, 0x0c, 0x30, 0x0c, 0xff, 0xfc, 0x30, 0xff,
-    0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x3c, 0xff, 0xcf, 0xf3, 0x3c, 0xff, 0xcf, 0xf3, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00,
-    0x0c, 0x30, 0x00, 0x00, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xfc, 0x0f, 0xf0, 0x3f, 0xfc, 0x0f, 0xf0, 0x3f, 0xff, 0xf0, 0x0f,
-    0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xf3, 0x33, 0xff, 0xcf, 0xf3, 0x33, 0xff, 0xcf, 0xf3, 0x00, 0x00,
-    0x0c, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x30, 0x0c, 0x0c, 0x30, 0x30, 0x0c, 0x0c, 0x30,
-    0x30, 0x0c, 0x3c, 0x3c, 0x30, 0x30, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xf3, 0x3c, 0xff, 0xcf, 0xf3, 0x3c, 0xff,
-    0xcf, 0xf3, 0x00, 0x00, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0x00, 0x00, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x30, 0x0c, 0x0c, 0x30,
-    0x30, 0x0c, 0x0c, 0x30, 0x30, 0x0c, 0x3c, 0x3c, 0x30, 0x30, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xf3, 0x33, 0xff,
-    0xcf, 0xf3, 0x33, 0xff, 0xcf, 0xf3, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xcf, 0x33, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0x0f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xf3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xcf, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-    0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0x33, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc,
-    0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xff, 0xff, 0xc3, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xcc, 0x00, 0x00, 0x33, 0xff, 0xff,
-    0xff, 0xff, 0xcc, 0x00, 0x00, 0x33, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,
-    0x00, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00,
-    0x00, 0x33, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xf3, 0xff, 0xfc, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x33, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xff, 0x3f, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0x00,
-    0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3c, 0x00, 0x3f, 0xc0, 0x3c, 0x3f, 0xff, 0xff, 0xff,
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xfc, 0x3f, 0xff, 0xf3,
-    0x00, 0x00, 0xcf, 0x30, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0c, 0x30, 0x0f, 0xf0, 0x0c,
-    0x3f, 0xff, 0xff, 0xff, 0x3c, 0x30, 0x0c, 0x0c, 0x30, 0x30, 0x0c, 0x0c, 0x30, 0x30, 0x0c, 0x3c, 0x3c, 0x33, 0xff,
-    0xfc, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f,
-    0xfc, 0x3f, 0xf0, 0x3f, 0xfc, 0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xff,
-    0xf0, 0x0f, 0xff, 0xf3, 0xc0, 0x03, 0xcf, 0x3c, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x00,
-    0x3c, 0x03, 0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x3c, 0x30, 0x0c, 0x0c, 0x30, 0x30, 0x0c, 0x0c, 0x30, 0x30, 0x0c,
-    0x3c, 0x3c, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xf0, 0x3f,
-    0xfc, 0x0f, 0xf0, 0x3f, 0xfc, 0x0f, 0xf3, 0x30, 0x0c, 0x0f, 0xf0, 0x3f, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x00, 0x00, 0xcf, 0xff, 0xf3, 0xcf, 0xff, 0xf3, 0xc0, 0x03, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xfc, 0x0f, 0xf0, 0x3f, 0xfc,
-    0x0f, 0xf0, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xfc, 0x0f, 0xf0, 0x3f,
-    0xfc, 0x0f, 0xf3, 0x30, 0x0c, 0x0f, 0xf3, 0x30, 0x0c, 0x0f, 0xfc, 0xc0, 0x03, 0x3f, 0xf3, 0x30, 0x0c, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xfc, 0x3f, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x30, 0xcf,
-    0xff, 0xff, 0xf3, 0x0f, 0xff, 0xff, 0xff, 0xcc, 0x30, 0x0c, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x30,
-    0x0c, 0xcf, 0xf3, 0x30, 0x0c, 0x0f, 0xfc, 0xc0, 0x03, 0x3f, 0xfc, 0xc0, 0x03, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xfc,
-    0xc0, 0x03, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xcf, 0xf3, 0xff, 0xf3, 0x33, 0x33, 0xcf,
-    0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x33, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff,
-    0xff, 0x3c, 0x30, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xc0, 0x03, 0x3f, 0xfc, 0xc0, 0x03, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff,
-    0x03, 0x0c, 0xff, 0xcf, 0x0c, 0x30, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xf0, 0x0f, 0xff,
-    0xf3, 0xcc, 0xcc, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x3c, 0x3f, 0xff,
-    0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xff,
-    0x03, 0x0c, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xcf, 0x0c, 0x30, 0xf3, 0xff, 0x0f, 0xff, 0x0f, 0xf3, 0x00, 0x00, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0c, 0x30, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x30, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xff,
-    0x03, 0x0c, 0xff, 0xf0, 0xc3, 0x0c, 0xcf, 0xc3, 0x00, 0xf0, 0xc3, 0xf3, 0x03, 0xc0, 0xcf, 0xfc, 0x0f, 0xff, 0x03,
-    0xf3, 0x00, 0x00, 0xcf, 0xff, 0xfc, 0x3f, 0xff, 0xf3, 0xc0, 0x03, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xf0, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x30, 0xff, 0xff,
-    0x03, 0x0c, 0xff, 0xf0, 0xc0, 0xf0, 0xcf, 0xf0, 0xc0, 0xf0, 0xcf, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xfc, 0xcc, 0x03, 0x03, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xff, 0x3f, 0xff, 0xf3, 0xc0, 0x03, 0xcf, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3c, 0x3f, 0xfc, 0x30, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xc3, 0xc3, 0x0f, 0xf0, 0xc0, 0xf0, 0xcf, 0xf0, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x0c, 0x3f,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0x30, 0x00, 0xcf, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xfc, 0xff, 0xff, 0xf3, 0x00, 0x00,
-    0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x30, 0x3c, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xf0, 0xc0, 0x03, 0xcf, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0x3f,
-    0xfc, 0x3f, 0xff, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xfc, 0x3f,
-    0xff, 0xf3, 0x00, 0x00, 0xcf, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x33, 0xff,
-    0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x0c, 0xff, 0xff, 0xfc, 0x30, 0xff,
-    0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xfc, 0xc3, 0x03, 0x3f, 0xcf, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x33, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xf0, 0xc0, 0xfc,
-    0x3f, 0xcc, 0x00, 0x00, 0x33, 0xff, 0xf3, 0xcf, 0xff, 0xcc, 0x00, 0x00, 0x33, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x33, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x33, 0xc0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf3, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-    0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xf3, 0x33, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc,
-    0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc,
-    0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0xff, 0xf0, 0x00,
-    0x00, 0x0f, 0xff, 0x00, 0x00, 0xcf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30,
-    0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xf3, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x03, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc,
-    0xff, 0xff, 0x3f, 0xfc, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00,
-    0x00, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x3f, 0x00, 0x00, 0xcf, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0x03, 0x03, 0x33, 0x03, 0x03, 0x03, 0x33,
-    0x03, 0xcf, 0x03, 0x3c, 0x3f, 0x3c, 0x0c, 0x3c, 0xff, 0xff, 0xf3, 0x03, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc,
-    0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x00, 0x00, 0x0c, 0x30, 0xf0, 0xcf, 0x0c, 0x30, 0x00, 0x00, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0x03, 0x03, 0xcf,
-    0x03, 0x03, 0x03, 0xcf, 0x03, 0x33, 0x03, 0xfc, 0x3c, 0xcc, 0x0c, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc,
-    0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0x30, 0x0c, 0xff, 0xfc, 0x3f,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x0c, 0x30, 0x03, 0x00, 0x0c, 0x30, 0x00, 0x00, 0xcf, 0x33,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc, 0xff, 0xff, 0xff, 0xf3,
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xfc,
-    0x0f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0x30, 0x0c, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xfc, 0xc0,
-    0x03, 0x3f, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x0c, 0x30, 0x00, 0xc0, 0x0c, 0x30,
-    0x00, 0x00, 0xcf, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0xff, 0xff, 0xff, 0xfc, 0x0c, 0xf3, 0xc0, 0xc0, 0xc0, 0xf3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xf0, 0x0c, 0x33, 0x3f,
-    0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xfc, 0xc0, 0x03, 0x3f, 0xfc, 0xc0,
-    0x03, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xfc, 0xc0, 0x03, 0x3f, 0xff, 0xcf, 0xff, 0x3f, 0xf3, 0x00, 0x00, 0x0c, 0x30,
-    0x03, 0x00, 0x0c, 0x30, 0x00, 0x00, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xcc, 0xc0, 0xc0, 0xc0, 0xcc, 0xc0, 0xc0, 0xc0, 0xff, 0xc0,
-    0xfc, 0x3c, 0x3c, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xc0, 0x03, 0x3f, 0xfc, 0xc0, 0x03, 0x3f, 0xff, 0xc0,
-    0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xcf, 0x0c, 0x30, 0xf3, 0xff, 0xcf, 0xff, 0x3f, 0xfc,
-    0xc0, 0x00, 0x0c, 0x30, 0x00, 0xc0, 0x0c, 0x30, 0x00, 0x03, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0,
-    0x03, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xcf, 0x0c, 0x30, 0xf3, 0xff,
-    0x0f, 0xff, 0x0f, 0xfc, 0xc0, 0x00, 0x0c, 0x30, 0x03, 0x00, 0x0c, 0x30, 0x00, 0x03, 0x3f, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x03, 0xff,
-    0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x33, 0x30, 0x0f, 0xc0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c,
-    0x30, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xf0, 0xc3, 0x0c, 0xcf, 0xc3, 0x00, 0xf0, 0xc3, 0xf3,
-    0x03, 0xc0, 0xcf, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x30, 0x00, 0x0c, 0x30, 0x00, 0xc0, 0x0c, 0x30, 0x00, 0x0c, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0c, 0x30, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xf0, 0xc0, 0xf0, 0xcf, 0xf0, 0xc0, 0xf0, 0xcf, 0xff,
-    0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xcc, 0x03, 0x3f, 0xff, 0xcf, 0x00, 0x0c, 0x30, 0xf3, 0x0f, 0x0c,
-    0x30, 0x00, 0xf3, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0xc3, 0x0f, 0xf0, 0xc0, 0xf0, 0xcf, 0xf0, 0xc0, 0x03, 0xcf, 0xff,
-    0xc0, 0x03, 0xff, 0xff, 0x00, 0x0c, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xff, 0x30, 0x00, 0xcf, 0xff, 0xf0, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xf0, 0xc0, 0x03, 0xcf, 0xff,
-    0xf0, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0x3f, 0xfc, 0x3f, 0xff, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x3f,
-    0xff, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff,
-    0xc0, 0x0c, 0xff, 0xff, 0xfc, 0x30, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff,
-    0xfc, 0xc3, 0x03, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x03,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xfc, 0xff, 0xf0, 0xc0, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xf0, 0x0c, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x30, 0xf0, 0x0f, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0f, 0x3c, 0x3f, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0x0c, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xc0, 0xff, 0xff, 0x03, 0xfc, 0x3f, 0x30, 0xf0, 0x0f, 0x0c, 0x3f, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0x3f, 0xfc,
-    0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3f, 0x00, 0x00, 0xfc, 0x3c, 0x3f, 0x30, 0xf0,
-    0x0f, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0x03, 0xff, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xff, 0xff, 0xf0, 0x3c, 0x3f, 0x33, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0x3f, 0xfc, 0x0f, 0xf0, 0x3f, 0xfc,
-    0x0f, 0xff, 0x30, 0x0c, 0xff, 0xf0, 0x3f, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xc0, 0xff, 0xff, 0x03,
-    0xcf, 0xff, 0x30, 0xf0, 0x0f, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x30, 0x30,
-    0x0f, 0xcf, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xfc, 0x0f, 0xf0, 0x3f, 0xfc, 0x0f, 0xff, 0x30, 0x0c,
-    0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc,
-    0x3f, 0xc0, 0x00, 0xfc, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcc, 0xc3,
-    0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0x30, 0x0c,
-    0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x33, 0xfc, 0x00, 0x00, 0xff, 0xcc, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x3c, 0xff, 0xff,
-    0xcc, 0x30, 0xf3, 0xff, 0xff, 0xff, 0x03, 0x3c, 0x3c, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xc0, 0x03,
-    0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xcf, 0x0c,
-    0x30, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xc0, 0x03, 0xff, 0xcc, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0x3c, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x3c, 0x3c, 0xff, 0xfc, 0x3c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xff, 0x03,
-    0x0c, 0xff, 0xcf, 0x0c, 0x30, 0xf3, 0xfc, 0x3f, 0xff, 0xc3, 0xfc, 0xcf, 0xff, 0xc0, 0x03, 0xff, 0xf3, 0x3f, 0xff,
-    0xc0, 0x03, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xfc,
-    0x30, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0x0c, 0x30, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xf0, 0xc3,
-    0x0c, 0xcf, 0xc3, 0x00, 0xf0, 0xc3, 0xf3, 0x03, 0xc0, 0xcf, 0xfc, 0x0f, 0xff, 0x03, 0xfc, 0xcf, 0xff, 0xf0, 0x0f,
-    0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x03, 0x0f, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0xfc,
-    0xf0, 0x0c, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xcc, 0x0f, 0xff, 0x0c, 0x30, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xf0, 0xc0,
-    0xf0, 0xcf, 0xf0, 0xc0, 0xf0, 0xcf, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xcc, 0x03, 0x3f, 0xfc,
-    0xcf, 0xff, 0xf0, 0x0f, 0xff, 0x33, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x03, 0xff, 0xff, 0xff, 0xcf, 0xfc,
-    0xff, 0xff, 0xff, 0xf3, 0x3c, 0x3f, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc3, 0xc3, 0x0f, 0xf0, 0xc0,
-    0xf0, 0xcf, 0xf0, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x0c, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xff,
-    0xf0, 0x00, 0xff, 0xf3, 0x30, 0xff, 0xfc, 0x3f, 0xff, 0x3c, 0xcf, 0xff, 0xf0, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xfc, 0xc3, 0xf0, 0xc0,
-    0x03, 0x0f, 0xf0, 0xc0, 0x03, 0xcf, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0x3f, 0xfc, 0x3f, 0xff, 0x3f, 0xff,
-    0xc0, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xf3, 0x30, 0x0f, 0xfc, 0x3f, 0xf0, 0x0c, 0xcf, 0xff, 0xf0, 0x0f, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xff, 0x0c, 0x0c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xc0, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff,
-    0xfc, 0xc3, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x0c, 0xff, 0xff, 0xfc, 0x30, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xfc, 0xc3, 0x03, 0x3f, 0xf3, 0x30, 0x00, 0xf3, 0xcf, 0x00, 0x0c, 0xcf,
-    0xff, 0xf0, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xf0, 0x0c, 0x0c, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xc0, 0xf0, 0x0f, 0xff,
-    0xff, 0xf0, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xf0, 0xc0, 0xfc, 0x3f, 0xf3, 0x30, 0x00, 0x0c,
-    0x30, 0x00, 0x0c, 0xcf, 0xff, 0xf0, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x30, 0x00, 0x0c, 0x30, 0x00, 0x0c, 0xcf, 0xff, 0xfc, 0x3f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x30, 0x00, 0xf3, 0xcf, 0x00, 0x0c, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x03,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x30, 0x0c, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x30, 0x0f, 0xfc, 0x3f, 0xf0, 0x0c, 0xcf, 0xcf, 0x0f, 0xf0,
-    0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xf0, 0x0c, 0xff, 0xff, 0xf0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3c, 0xff, 0xfc, 0x3f, 0xff, 0x0c,
-    0xcf, 0xcf, 0x0f, 0xf0, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xcf,
-    0xf3, 0xff, 0xff, 0xcf, 0xf0, 0x0f, 0xf0, 0x0f, 0xf3, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0xff,
-    0xf0, 0x0f, 0xff, 0xf3, 0x3f, 0xcf, 0x0f, 0xf0, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0xfc, 0x3c, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xcf,
-    0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xcf, 0xff, 0xf0, 0x0f, 0xff, 0xf3, 0x3f, 0xcf, 0x0f, 0xf0, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x30, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf0, 0x0c, 0x3f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0x0f,
-    0xf0, 0x0f, 0xf0, 0x0f, 0xfc, 0x30, 0x0c, 0x3f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xfc, 0x30, 0x0c,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xc0, 0x03, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f,
-    0x30, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x30, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0c, 0x3f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0xc0, 0x03, 0xff, 0xcc, 0xff, 0xc0, 0x00,
-    0x00, 0x03, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3c, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03,
-    0xff, 0xff, 0x03, 0x0c, 0xff, 0xcf, 0x0c, 0x30, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0x00, 0x00, 0x3f,
-    0xcc, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x0f, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xfc, 0x3c, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x03, 0x0c,
-    0xff, 0xff, 0x03, 0x0c, 0xff, 0xff, 0x03, 0x0c, 0xff, 0xcf, 0x0c, 0x30, 0xf3, 0xfc, 0xff, 0xff, 0xf3, 0xff, 0xcc,
-    0x3f, 0x00, 0x03, 0xfc, 0x33, 0xff, 0xff, 0xc0, 0x03, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0c, 0xff, 0xff, 0xcc, 0x0c, 0x0c, 0xc3,
-    0xc0, 0xfc, 0xc0, 0xf0, 0x0f, 0xff, 0xfc, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x30, 0xff, 0xff, 0x03, 0x0c,
-    0xff, 0xff, 0x03, 0x0c, 0xff, 0xf0, 0xc3, 0x0c, 0xcf, 0xc3, 0x00, 0xf0, 0xc3, 0xf3, 0x03, 0xc0, 0xcf, 0xfc, 0x03,
-    0xfc, 0x03, 0xff, 0xf3, 0xc0, 0xff, 0xff, 0x03, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xc3, 0x3f, 0xff, 0xff, 0xff, 0x0c, 0x30,
-    0xff, 0xff, 0x03, 0x0c, 0xff, 0xf0, 0xc0, 0xf0, 0xcf, 0xf0, 0xc0, 0xf0, 0xcf, 0xff, 0x00, 0x03, 0xff, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0x0c, 0x03, 0x0f, 0xfc, 0x3c, 0x3f, 0x00, 0x00, 0xfc, 0x3c, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0x3c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3c, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff,
-    0x3f, 0x03, 0x33, 0x03, 0x03, 0x03, 0xcf, 0x03, 0x30, 0x30, 0x3c, 0xfc, 0x3c, 0x3c, 0xf0, 0x3c, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xc3, 0xc3, 0x0f, 0xf0, 0xc0, 0xf0, 0xcf, 0xf0, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x03, 0xff, 0xff, 0x00,
-    0x0c, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xfc, 0x3f, 0xc0, 0xff, 0xff, 0x03, 0xfc, 0x3f, 0xff,
-    0xf0, 0x0f, 0xff, 0xcf, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xc3, 0xff, 0xf3,
-    0xff, 0xff, 0xff, 0xff, 0x3f, 0x03, 0xcf, 0x03, 0x03, 0x03, 0x33, 0x03, 0x30, 0x30, 0x33, 0x3c, 0x3c, 0x33, 0x30,
-    0x3c, 0xc0, 0xc3, 0xff, 0xff, 0xf0, 0xc0, 0x03, 0x0f, 0xf0, 0xc0, 0x03, 0xcf, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xc0,
-    0x0f, 0x3f, 0xfc, 0x3f, 0xff, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xcf, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xcf, 0xc3, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xc0, 0xc3, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x0c, 0xff, 0xff, 0xfc,
-    0x30, 0xff, 0xff, 0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xfc, 0xc3, 0x03, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0x33, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
-    0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xf0,
-    0xc0, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xcf, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-    0xfc, 0xcf, 0xff, 0xff, 0xff, 0x33, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3,
-    0xc3, 0xcc, 0xc0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0c, 0x30, 0x00, 0x00, 0x0c, 0xcf, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xc0, 0xff, 0xff, 0x03, 0xfc, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xcf, 0xff, 0xff, 0xff, 0x3f, 0x03, 0x03, 0x33, 0x03, 0x03,
-    0x03, 0x33, 0x03, 0xcf, 0x03, 0x3c, 0x3c, 0x0c, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c, 0x3f, 0x00, 0x00, 0xfc, 0x3c, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0x3f, 0x03,
-    0x03, 0xcf, 0x03, 0x03, 0x03, 0xcf, 0x03, 0x33, 0x03, 0xfc, 0x3c, 0x0c, 0xff, 0xfc, 0xc3, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0x03, 0xc0, 0xff, 0xff, 0xf3, 0xc0, 0xff, 0xff, 0x03, 0xcf, 0xff, 0xff, 0xf0, 0x0f,
-    0xff, 0x33, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc, 0xcf, 0xff,
-    0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xc3,
-    0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x33, 0xcc, 0xff, 0xff, 0xcc, 0x3f, 0xff, 0xff, 0xfc, 0x33,
-    0xff, 0xff, 0xf0, 0x0f, 0xff, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-    0x3c, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0x0c, 0xf3, 0xc0, 0xc0, 0xc0, 0xf3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xf0, 0x0c,
-    0xcf, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f,
-    0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x0c, 0x30, 0xff, 0xff, 0x33, 0xc0,
-    0xff, 0xff, 0x03, 0xcc, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xcc, 0xc0, 0xc0, 0xc0, 0xcc, 0xc0, 0xc0, 0xc0,
-    0xff, 0xc0, 0xfc, 0x3f, 0x3f, 0xff, 0xfc, 0xc3, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f,
-    0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0x3f,
-    0xff, 0xff, 0x33, 0x00, 0x3f, 0xfc, 0x00, 0xcc, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f,
-    0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0x00, 0x3f, 0xfc, 0x00, 0x33, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x0c,
-    0x33, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xcc, 0x30, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x00, 0x00, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0x00, 0x00,
-    0x3f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0x00, 0x0f, 0xf0, 0x00, 0x33, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0x0c, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x30, 0x0f, 0xff, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f,
-    0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0x00, 0x0f, 0xf0, 0x00,
-    0x33, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3c,
-    0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xcf, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0x0f, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
-    0xff, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f,
-    0x00, 0x0f, 0xf0, 0x00, 0xfc, 0xcf, 0xff, 0xf0, 0x0f, 0xff, 0xcf, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xcf, 0xc3, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3c, 0x3f, 0xff, 0x33, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfc, 0xf3, 0xcf,
-    0x3f, 0xfc, 0xf3, 0xcf, 0x3f, 0xfc, 0xf3, 0xcf, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x3f, 0xf0, 0x03, 0xc0, 0x03, 0xfc, 0xcf, 0xff, 0xf0, 0x0f, 0xff, 0xcf, 0xc3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xc3, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf3, 0xcf,
-    0x3f, 0xfc, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xff,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xc3, 0xc3, 0xff, 0xfc, 0xcf, 0xff, 0xf0, 0x0f, 0xff, 0xf0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
-    0x33, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xcc, 0x33, 0xc3, 0xc3, 0xcc, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf3,
-    0xcf, 0x0f, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0xcf, 0xff,
-    0xf0, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xfc, 0x3f,
-    0xff, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x3f, 0xff, 0xc3, 0xc3, 0xff, 0xfc, 0xcf, 0xfc, 0x00, 0x03, 0x3f, 0xfc, 0x00, 0x03, 0x3f, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x3f, 0xf0, 0x03, 0xc0, 0x0f, 0xfc, 0xcf, 0xf0, 0x03, 0xff, 0xcf, 0xf0, 0x03, 0xff, 0xcf,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0x00, 0x0f, 0xf0, 0x00, 0xfc, 0xcf, 0xff, 0xf3, 0xcf, 0xcf,
-    0xff, 0xf3, 0xff, 0xcf, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x33, 0xc0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xcc, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x3c, 0xff, 0x3f, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x3c, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0x00, 0x0f, 0xf0, 0x00, 0x33, 0x3f,
-    0xc0, 0x0f, 0xcf, 0xf3, 0xc0, 0x0f, 0xff, 0xf3, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x33, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xcc, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc,
-    0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcc, 0x00, 0x0f,
-    0xf0, 0x00, 0x33, 0x3f, 0xff, 0xcf, 0xcf, 0xf3, 0xff, 0xcc, 0x30, 0xf3, 0x0c, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x30, 0x0c, 0x3f, 0xfc,
-    0x30, 0x0c, 0x3f, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x33, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xcc, 0x00, 0x3f, 0xfc, 0x00, 0x33, 0x3f, 0xff, 0xcf, 0xff, 0xf3, 0xff, 0xcc, 0x30, 0xf3, 0x0c, 0xcc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0x30, 0x0c, 0x3f, 0xff,
-    0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xc0, 0xc3, 0xff,
-    0xff, 0x0c, 0x30, 0xff, 0xff, 0x33, 0x00, 0x3f, 0xfc, 0x00, 0xcc, 0xff, 0xc0, 0x0c, 0xcc, 0xf3, 0xc0, 0x0f, 0xcf,
-    0xf3, 0x0c, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff,
-    0xc0, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f,
-    0xfc, 0xc3, 0x03, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x33, 0xc0, 0xff, 0xff, 0x03, 0xcc, 0xff, 0xc0, 0x0c, 0xcc,
-    0xf3, 0xc0, 0x0f, 0xcf, 0xf3, 0x0c, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x30, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3c, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f,
-    0xfc, 0x30, 0x0c, 0x3f, 0xff, 0x30, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x3f, 0xff, 0xff, 0xfc, 0x33,
-    0xff, 0xc0, 0x0f, 0xff, 0xf3, 0xc0, 0x0c, 0x30, 0xf3, 0x0c, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-    0x3f, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f,
-    0xfc, 0xf0, 0x0f, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xfc, 0xf0, 0x0f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xc0,
-    0xff, 0xff, 0x03, 0xcf, 0xff, 0xc0, 0x0f, 0xcf, 0xf3, 0xc0, 0x0c, 0x30, 0xf3, 0x0c, 0xff, 0x00, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x00, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f,
-    0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0xcf, 0xf3, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x3c, 0x3f, 0x00, 0x00, 0xfc, 0x3c, 0x3f, 0xc0, 0x0f, 0xcf, 0xf3, 0xc0, 0x0f, 0xff, 0xf3, 0x0c, 0xff,
-    0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0xf0, 0x0f, 0x3f,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xf3, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xc0, 0xff, 0xff, 0x03, 0xfc, 0x3f, 0xf0, 0x03, 0xcf, 0xcf, 0xf0, 0x03,
-    0xff, 0xcf, 0x0c, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c,
-    0xff, 0x00, 0x00, 0xff, 0xfc, 0xf3, 0xcf, 0x3f, 0xfc, 0xf3, 0xcf, 0x3f, 0xfc, 0xf3, 0xcf, 0x3f, 0xfc, 0xf0, 0x0f,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x03,
-    0xff, 0xcf, 0xf0, 0x03, 0xff, 0xcf, 0x0c, 0xff, 0xfc, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3f, 0xff, 0x30, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3c, 0xfc, 0xf3, 0xcf, 0x3f, 0xfc, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0x3f, 0xfc, 0xff, 0xff,
-    0x3f, 0xf3, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x00, 0x03, 0x3f, 0xfc, 0x00, 0x03, 0x3f, 0x0c, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf3, 0xcf, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xc0, 0xff,
-    0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c,
-    0xff, 0xff, 0xc3, 0x03, 0xff, 0xff, 0xc0, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff,
-    0xf0, 0x0f, 0xff, 0x0c, 0xff, 0xff, 0xc3, 0x00, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x3c, 0x0f, 0xc0, 0x03, 0xf0, 0x3c, 0x33, 0xff,
-    0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0x0c, 0xff, 0xff, 0xc3, 0x00, 0x3f, 0xfc, 0x00, 0xc3, 0xff, 0xff, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x3c, 0x0f, 0xc0, 0x03,
-    0xf0, 0x3c, 0x33, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xfc, 0x3f, 0x3f, 0x0c, 0xff, 0xff, 0xc3, 0xc0, 0x0f, 0xf0, 0x03,
-    0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xc0, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00,
-    0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xcc,
-    0x3c, 0x0f, 0xc0, 0x03, 0xf0, 0x3c, 0x33, 0xf3, 0x0f, 0xf0, 0xcf, 0xf3, 0xfc, 0x3f, 0xcf, 0x0c, 0xff, 0xff, 0xc3,
-    0xf0, 0x03, 0xc0, 0x0f, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00,
-    0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xf3, 0xcf, 0x3f, 0xcc, 0x3c, 0x0f, 0xc0, 0x03, 0xf0, 0x3c, 0x33, 0xf3, 0x03, 0xc0, 0xcf, 0xf3, 0xfc, 0x3f, 0xcf,
-    0x0c, 0xff, 0xff, 0xc3, 0xfc, 0x03, 0xc0, 0x3f, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0x00,
-    0x00, 0x3f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xcc, 0x3c, 0x0f, 0xc0, 0x03, 0xf0, 0x3c, 0x33, 0xcf, 0xc3, 0xc3, 0xf3,
-    0xcf, 0xff, 0xff, 0xf3, 0x0c, 0xff, 0xff, 0xc3, 0xff, 0x0c, 0x30, 0xff, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x3c, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xfc,
-    0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0c, 0x3f, 0xcc, 0x3c, 0x0f, 0xc0, 0x03, 0xf0, 0x3c, 0x33,
-    0xcf, 0xfc, 0x3f, 0xf3, 0xcc, 0x0c, 0x30, 0x33, 0x0c, 0xff, 0xff, 0xc3, 0xff, 0xf3, 0xcf, 0xff, 0xc3, 0xff, 0xff,
-    0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xf0, 0x00, 0x00, 0x0f, 0xf3, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xcf, 0xf3,
-    0xff, 0xff, 0xcf, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x03, 0xff, 0xf3, 0xff, 0xff, 0xcf, 0xcc, 0x3c, 0x0f, 0xc0,
-    0x03, 0xf0, 0x3c, 0x33, 0xcf, 0xfc, 0x3f, 0xf3, 0xcc, 0x0c, 0x30, 0x33, 0x0c, 0xff, 0xff, 0xc3, 0xff, 0xf3, 0xcf,
-    0xff, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xf3, 0xff, 0xff, 0xcf, 0xfc, 0x00, 0x00, 0x3f, 0xfc,
-    0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xc3, 0xc3, 0xf3, 0xcf, 0xff, 0xff, 0xf3, 0x0c, 0xff, 0xff,
-    0xc3, 0xff, 0x0c, 0x30, 0xff, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0x00, 0x00, 0x3f, 0xf3,
-    0xff, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xcf, 0xf3, 0xff, 0xff, 0xcf, 0xfc, 0x00, 0x00, 0x3f,
-    0xf3, 0xff, 0xff, 0xcf, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf3, 0x03, 0xc0, 0xcf, 0xf3, 0xfc, 0x3f,
-    0xcf, 0x0c, 0xff, 0xff, 0xc3, 0xfc, 0x03, 0xc0, 0x3f, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xf3,
-    0xff, 0xff, 0xcf, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0x00, 0x00, 0x3f,
-    0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xf3, 0x0f, 0xf0,
-    0xcf, 0xf3, 0xfc, 0x3f, 0xcf, 0x0c, 0xff, 0xff, 0xc3, 0xf0, 0x03, 0xc0, 0x0f, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3c, 0xfc, 0xf0, 0x0f, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
-    0xf3, 0xff, 0xff, 0xcf, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xfc, 0x3f, 0x3f, 0x0c, 0xff, 0xff, 0xc3, 0xc0, 0x0f, 0xf0, 0x03, 0xc3, 0xff,
-    0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x00, 0x00, 0xff, 0xfc, 0xf3, 0xcf, 0x3f, 0xfc, 0xf3, 0xcf, 0x3f,
-    0xfc, 0xf3, 0xcf, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xf0, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0x0c, 0xff, 0xff, 0xc3, 0x00, 0x3f,
-    0xfc, 0x00, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0xf3, 0xcf, 0x3f, 0xfc, 0xff, 0xfc, 0x3f,
-    0xfc, 0x3f, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xf3, 0x00, 0x00, 0xcf, 0xf3, 0xff, 0xff, 0xcf, 0xfc, 0x00, 0x00,
-    0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0x0c, 0xff,
-    0xff, 0xc3, 0x00, 0xff, 0xff, 0x00, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f,
-    0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf3, 0xcf, 0x0f, 0xfc, 0x00, 0x00,
-    0x3f, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0c, 0xff, 0xff, 0xc3, 0x03, 0xff, 0xff, 0xc0, 0xc3, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x0c, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0x30, 0x30,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf3, 0xcf, 0xf3, 0x0c, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0c, 0x3f, 0xf3, 0xc3,
-    0xf0, 0x3f, 0xfc, 0x0f, 0xc3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x0c, 0x0c, 0xff, 0xfc, 0x0c, 0x00,
-    0x00, 0x00, 0x00, 0x30, 0x3f, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-    0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xcc, 0x33, 0xff, 0xf0, 0x0c, 0x30,
-    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x30,
-    0x0c, 0x33, 0xf3, 0xc3, 0xf0, 0x3f, 0xfc, 0x0f, 0xc3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x33, 0xf0, 0x0f, 0xcc, 0x0c,
-    0xff, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf3, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcc, 0x3f, 0xfc, 0x33, 0xf3, 0xc3, 0xf0, 0x3f, 0xfc, 0x0f, 0xc3, 0xcf, 0xf0, 0x00, 0x00, 0x0f, 0x33,
-    0xff, 0xff, 0xcc, 0x0c, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x3c, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xf0, 0x0f, 0xc3, 0xff, 0xc0,
-    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xf3, 0xf3, 0xc3, 0xf0, 0x3f, 0xfc, 0x0f, 0xc3, 0xcf, 0xcf,
-    0xff, 0xff, 0xf3, 0x33, 0xff, 0xff, 0xcc, 0x0c, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0x30,
-    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xc0,
-    0x03, 0x03, 0xc0, 0xc0, 0x03, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x3f, 0xf3, 0xc3, 0xf0, 0x3f, 0xfc,
-    0x0f, 0xc3, 0xcf, 0x33, 0x33, 0x33, 0x3c, 0x33, 0xff, 0xff, 0xcc, 0x0c, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x3f, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x3f, 0xf0, 0x0c,
-    0x30, 0x0f, 0xcc, 0xc0, 0x03, 0x33, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0x0f, 0x3f, 0xf3,
-    0xc3, 0xf0, 0x3f, 0xfc, 0x0f, 0xc3, 0xcf, 0x3c, 0xcc, 0xcc, 0xcc, 0x33, 0xff, 0xff, 0xcc, 0x0c, 0xff, 0x03, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0x00, 0x00, 0x3f, 0xfc, 0x00,
-    0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x00, 0x00, 0xc3, 0xff, 0x3c, 0x3c, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xfc,
-    0x00, 0x00, 0x3f, 0xf3, 0xc3, 0xf0, 0x3f, 0xfc, 0x0f, 0xc3, 0xcf, 0x30, 0x00, 0x00, 0x0c, 0x33, 0xff, 0xff, 0xcc,
-    0x0c, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0xf0,
-    0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x3c, 0x3c, 0xff, 0xf3, 0x3c, 0x3c, 0xcf, 0xf0,
-    0xc0, 0x03, 0x0f, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x0c,
-    0x3f, 0xf3, 0xcf, 0xfc, 0x0c, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0x30, 0x30, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x3c, 0xfc, 0xf0, 0x0f, 0x3f, 0xfc, 0xf0, 0x0f, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xf3, 0x3c, 0x3c, 0xcf, 0xf3,
-    0x00, 0x00, 0xcf, 0xcc, 0xc0, 0x03, 0x33, 0xfc, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-    0x3f, 0xf3, 0xcf, 0xfc, 0x30, 0x03, 0xc0, 0x0c, 0x0c, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xc3,
-    0x00, 0x00, 0xc3, 0xfc, 0xf3, 0xcf, 0x3f, 0xc3, 0x00, 0x00, 0xc3, 0xfc, 0xf0, 0x0f, 0x3f, 0xff, 0xff, 0xff, 0xf0,
-    0x0f, 0xff, 0xff, 0xff, 0x30, 0x03, 0xc0, 0x0c, 0x30, 0x00, 0x00, 0x0c, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x33, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xcc, 0x30, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xfc, 0xf3, 0xcf, 0x3f, 0xfc, 0xf3, 0xcf, 0x3f, 0xfc,
-    0x00, 0x00, 0x3f, 0xcf, 0xf3, 0xcf, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xfc, 0xf0, 0x0f, 0x3f,
-    0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x3c, 0x3c, 0x00, 0x00, 0x3c, 0x0f, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x33, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x03, 0xcc, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc,
-    0x3f, 0xfc, 0x3f, 0xfc, 0x3c, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3c, 0x3c, 0xcf,
-    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00,
-    0x0c, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0x3f, 0xfc, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x00, 0x00, 0xcf, 0xfc, 0xf3, 0xcf, 0x3f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-    0xfc, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xf3, 0xcf, 0x03, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xff, 0xfc, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
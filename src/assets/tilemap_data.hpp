@@ -0,0 +1,42 @@
+// v. 1.0.0 tilemap, generated by tools/compress_tilemap.py from monochrome_tilemap_packed.png
+// Only included by src/assets.cpp, tilemap_lz.hpp declares these
+const uint8_t tilemapFrameFormats[19] = {
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+};
+const uint16_t tilemapOffsets[20] = {
+    0, 26, 52, 78, 105, 117, 129, 154, 180, 209, 238, 260,
+    291, 322, 353, 383, 403, 434, 454, 476,
+};
+const uint8_t tilemapData[476] = {
+    0x02, 0xff, 0x03, 0xf9, 0x9f, 0xf6, 0x6f, 0xe9, 0x97, 0x04, 0xd0, 0x0b, 0x10, 0xe8, 0x17, 0xf4,
+    0x2f, 0xfa, 0x40, 0x5f, 0xfd, 0xbf, 0xfe, 0x7f, 0xff, 0x03, 0x40, 0x00, 0x00, 0xff, 0xff, 0x80,
+    0x00, 0x10, 0xc8, 0x00, 0x18, 0xfc, 0x3c, 0xce, 0x72, 0xcb, 0xd3, 0xfe, 0x40, 0x7f, 0xf6, 0x7d,
+    0xff, 0xef, 0xff, 0x07, 0x30, 0x00, 0x00, 0xff, 0xff, 0x30, 0x00, 0x18, 0x18, 0x00, 0x3c, 0x3c,
+    0x4e, 0x72, 0xcb, 0xd3, 0x7e, 0x7f, 0x40, 0xf6, 0x7d, 0xff, 0xef, 0xdf, 0xff, 0x06, 0x40, 0x00,
+    0x00, 0xff, 0xff, 0x00, 0x01, 0x10, 0x18, 0x00, 0x13, 0x3c, 0x3f, 0x4e, 0x73, 0xcb, 0xd3, 0x7e,
+    0xc0, 0x7f, 0xf6, 0x7f, 0xff, 0xff, 0xdf, 0x20, 0x05, 0x88, 0xff, 0xe6, 0xff, 0x00, 0xfb, 0xff,
+    0xfe, 0x11, 0x03, 0x0f, 0x02, 0x06, 0xff, 0x0f, 0x03, 0xfe, 0xff, 0xf2, 0xff, 0xf3, 0x01, 0x71,
+    0xe6, 0x02, 0xff, 0x07, 0xe7, 0xe7, 0xc7, 0xe3, 0xd4, 0x2b, 0x40, 0xe8, 0x17, 0xf8, 0x1f, 0xf2,
+    0x4f, 0x10, 0xc9, 0x08, 0x93, 0xc8, 0x13, 0x90, 0xf7, 0xef, 0x02, 0xff, 0x07, 0xe7, 0xe7, 0xc7,
+    0xe3, 0xd4, 0x23, 0x40, 0xe8, 0x17, 0xf8, 0x1f, 0xf1, 0x2f, 0x10, 0xc8, 0x00, 0xcb, 0xc8, 0x1b,
+    0xf8, 0x2f, 0xf7, 0xef, 0x02, 0xff, 0x05, 0xe7, 0xe7, 0xc7, 0xe3, 0xd4, 0x23, 0x40, 0xe8, 0x17,
+    0xf8, 0x1f, 0xf1, 0x2f, 0x10, 0xc8, 0x00, 0xcb, 0xc8, 0x1b, 0xfc, 0xff, 0xfe, 0x4f, 0xff, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x59, 0x99, 0x3f, 0xff, 0x71, 0x15, 0x04, 0x71, 0x1b, 0x50, 0x2d, 0x88,
+    0x6a, 0x88, 0x7f, 0xe8, 0xff, 0x31, 0xff, 0x90, 0x63, 0x11, 0x50, 0x90, 0x01, 0xd0, 0x00, 0x00,
+    0x00, 0x99, 0x99, 0xff, 0xff, 0x11, 0x15, 0x84, 0x11, 0x1b, 0x50, 0x8d, 0x88, 0x8a, 0x88, 0x50,
+    0x06, 0xe3, 0x20, 0x09, 0x00, 0x00, 0x00, 0x99, 0x9a, 0xff, 0xfc, 0x1b, 0x16, 0x04, 0x15, 0x1e,
+    0x50, 0x88, 0x8c, 0x8f, 0x8e, 0xff, 0x60, 0xfe, 0xff, 0x54, 0xff, 0xbc, 0x51, 0x90, 0xfc, 0x04,
+    0xff, 0xe4, 0x70, 0x40, 0x7f, 0xff, 0x22, 0xbf, 0x23, 0x67, 0x50, 0x71, 0x00, 0xff, 0x31, 0xff,
+    0x3f, 0xff, 0x76, 0xff, 0x6a, 0x09, 0x51, 0x31, 0x3f, 0xd0, 0x7f, 0xff, 0x22, 0x3f, 0x04, 0x22,
+    0x27, 0x50, 0x10, 0xff, 0xfe, 0xff, 0xcc, 0x10, 0xfe, 0x7e, 0xff, 0x80, 0xc6, 0xfc, 0x44, 0xff,
+    0xfc, 0xff, 0x16, 0x11, 0x01, 0x50, 0xec, 0xff, 0xd6, 0xff, 0xfe, 0xfd, 0x8c, 0x04, 0xfa, 0x8c,
+    0x50, 0x00, 0x7f, 0xff, 0x31, 0xff, 0x3f, 0xff, 0x67, 0xff, 0x19, 0x70, 0x34, 0x7f, 0x10, 0x50,
+    0x63, 0xff, 0x22, 0x21, 0xf1, 0x71, 0x51, 0x71, 0xb1, 0x50, 0x59, 0x99, 0x00, 0x00, 0x00, 0x82,
+    0xff, 0x0c, 0x8f, 0xe3, 0xff, 0xa2, 0x29, 0x60, 0x10, 0x11, 0xb1, 0x11, 0x51, 0x50, 0x99, 0x99,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0xfe, 0xff, 0xd4, 0xff, 0x6c, 0x51, 0x8e, 0x00, 0xff, 0x8c, 0xff,
+    0xfc, 0xff, 0xe6, 0x8f, 0xfe, 0x42, 0x8e, 0x71, 0x44, 0x6e, 0x44, 0x56, 0x50, 0x99, 0x00, 0x9a,
+    0x00, 0x00, 0x02, 0xff, 0x09, 0xfc, 0x3f, 0xf0, 0x0f, 0xe0, 0x07, 0x19, 0x12, 0xec, 0x37, 0x10,
+    0xb0, 0xed, 0xb7, 0xe7, 0x00, 0xe7, 0x02, 0xff, 0x07, 0xfc, 0x3f, 0xf0, 0x0f, 0xe0, 0x07, 0x19,
+    0x12, 0xec, 0x37, 0x10, 0xb0, 0xed, 0xb7, 0xef, 0x00, 0xe7, 0xe7, 0xff,
+};
@@ -0,0 +1,26 @@
+// v. 1.0.0 tilemap, generated by tools/compress_tilemap.py from monochrome_tilemap_packed.png
+// 22 of 400 16x16 frames referenced, 19 stored, 19 of them at 1bpp, compressed to 476 bytes
+inline const int tilemapWidth = 320;
+inline const int tilemapHeight = 320;
+inline const int tilemapFlags = BLIT_2BPP;
+inline const int tilemapFrames = 19;
+// Largest frame once decoded, 32 bytes when every frame is stored at 1bpp
+inline const int tilemapFrameBytes = 32;
+// Index on the full sheet of each referenced frame, ascending
+inline const int tilemapReferenced = 22;
+inline constexpr uint16_t tilemapSheetFrames[22] = {
+    41, 84, 85, 86, 199, 219, 239, 240, 241, 242, 259, 275,
+    276, 277, 295, 297, 315, 316, 317, 320, 321, 322,
+};
+// Stored frame to draw for each of tilemapSheetFrames, with the flips to draw it
+// with in BLIT_FLIP_X << 12 and BLIT_FLIP_Y << 12
+inline constexpr uint16_t tilemapRemap[22] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x6004, 0x0006, 0x0007, 0x0008, 0x6005, 0x0009,
+    0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x2012,
+};
+// 0 for frames stored at 2bpp; for 1bpp frames 0x10, with the palette index
+// drawn for a 0 bit in bits 0-1 and the one for a 1 bit in bits 2-3
+extern const uint8_t tilemapFrameFormats[19];
+// Where each frame starts in tilemapData, and one past the last frame
+extern const uint16_t tilemapOffsets[20];
+extern const uint8_t tilemapData[476];
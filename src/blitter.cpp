@@ -0,0 +1,161 @@
+#include "blitter.hpp"
+
+#include "wasm4.h"
+
+#include <string.h>
+
+namespace blitter {
+
+namespace {
+
+constexpr int size = 16;
+
+uint32_t useCounter = 0;
+
+// Reads a row of the frame into framebuffer order: pixel i of the row in bits
+// 2i and 2i + 1, mapped through the draw colors, with the mask covering every
+// pixel that is not transparent
+void loadRow(const uint8_t* pixels, bool twoBits, int row, bool flipX, uint16_t colors, uint32_t& value,
+             uint32_t& mask) {
+    value = 0;
+    mask = 0;
+    const int start = row * size;
+    for (int column = 0; column < size; column++) {
+        const int src = start + (flipX ? size - 1 - column : column);
+        const int index =
+            twoBits ? (pixels[src / 4] >> (6 - 2 * (src % 4))) & 0x3 : (pixels[src / 8] >> (7 - src % 8)) & 0x1;
+        const uint32_t color = (uint32_t)(colors >> (4 * index)) & 0xf;
+        if (color != 0) {
+            value |= ((color - 1) & 0x3) << (2 * column);
+            mask |= 0x3u << (2 * column);
+        }
+    }
+}
+
+// Framebuffer bytes are read and written little endian, which is what WASM uses
+void merge(uint8_t* pixels, size_t bytes, uint64_t value, uint64_t mask) {
+    uint64_t word = 0;
+    memcpy(&word, pixels, bytes);
+    word = (word & ~mask) | value;
+    memcpy(pixels, &word, bytes);
+}
+
+Preshifted* find(std::span<Preshifted> cache, uint32_t key, const uint8_t* pixels, bool twoBits, bool flipX,
+                 bool flipY, uint16_t colors) {
+    if (cache.empty()) {
+        return nullptr;
+    }
+
+    Preshifted* oldest = &cache[0];
+    for (auto& entry : cache) {
+        if (entry.key == key) {
+            entry.lastUse = ++useCounter;
+            return &entry;
+        }
+        if (entry.lastUse < oldest->lastUse) {
+            oldest = &entry;
+        }
+    }
+
+    oldest->key = key;
+    oldest->lastUse = ++useCounter;
+    for (int row = 0; row < size; row++) {
+        uint32_t value, mask;
+        loadRow(pixels, twoBits, flipY ? size - 1 - row : row, flipX, colors, value, mask);
+        for (int shift = 0; shift < 4; shift++) {
+            oldest->value[shift][row] = (uint64_t)value << (2 * shift);
+            oldest->mask[shift][row] = (uint64_t)mask << (2 * shift);
+        }
+    }
+    return oldest;
+}
+
+} // namespace
+
+bool drawText(uint8_t* framebuffer, const uint8_t* font, char first, int glyphs, const char* text, size_t length,
+              int x, int y, uint16_t colors) {
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] < first || text[i] >= first + glyphs) {
+            return false;
+        }
+    }
+
+    const uint32_t ink = colors & 0xfu;
+    const uint32_t paper = (uint32_t)(colors >> 4) & 0xfu;
+    for (int row = 0; row < 8; row++) {
+        const int dy = y + row;
+        if (dy < 0 || dy >= SCREEN_SIZE) {
+            continue;
+        }
+        for (size_t i = 0; i < length; i++) {
+            const uint8_t bits = font[(text[i] - first) * 8 + row];
+            uint32_t value = 0;
+            uint32_t mask = 0;
+            for (int column = 0; column < 8; column++) {
+                const uint32_t color = (bits >> (7 - column)) & 1 ? ink : paper;
+                if (color != 0) {
+                    value |= ((color - 1) & 0x3) << (2 * column);
+                    mask |= 0x3u << (2 * column);
+                }
+            }
+
+            const int gx = x + (int)i * 8;
+            if (gx >= 0 && gx <= SCREEN_SIZE - 8) {
+                const int shift = gx % 4;
+                merge(framebuffer + (dy * SCREEN_SIZE + gx) / 4, shift == 0 ? 2 : 3, (uint64_t)value << (2 * shift),
+                      (uint64_t)mask << (2 * shift));
+                continue;
+            }
+            // Partly off screen, one pixel at a time
+            for (int column = 0; column < 8; column++) {
+                const int px = gx + column;
+                if (px >= 0 && px < SCREEN_SIZE) {
+                    const int shift = 2 * (px % 4) - 2 * column;
+                    const uint64_t pixel = 0x3ull << (2 * column);
+                    merge(framebuffer + (dy * SCREEN_SIZE + px) / 4, 1,
+                          shift >= 0 ? (value & pixel) << shift : (value & pixel) >> -shift,
+                          shift >= 0 ? (mask & pixel) << shift : (mask & pixel) >> -shift);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool canDraw(int x, uint32_t flags) {
+    return !(flags & BLIT_ROTATE) && x >= 0 && x <= SCREEN_SIZE - size;
+}
+
+void drawSprite(uint8_t* framebuffer, const uint8_t* pixels, int frame, int x, int y, uint32_t flags, uint16_t colors,
+                std::span<Preshifted> cache) {
+    const bool flipX = flags & BLIT_FLIP_X;
+    const bool flipY = flags & BLIT_FLIP_Y;
+    const bool twoBits = flags & BLIT_2BPP;
+
+    // A frame is always stored at the same bit depth, so that does not need to be in the key
+    const uint32_t key = (uint32_t)frame | (uint32_t)(flipX | flipY << 1) << 12 | (uint32_t)colors << 14;
+    const Preshifted* entry = find(cache, key, pixels, twoBits, flipX, flipY, colors);
+
+    const int shift = x % 4;
+    const size_t bytes = shift == 0 ? 4 : 5;
+    for (int row = 0; row < size; row++) {
+        const int dy = y + row;
+        if (dy < 0 || dy >= SCREEN_SIZE) {
+            continue;
+        }
+
+        uint64_t value, mask;
+        if (entry) {
+            value = entry->value[shift][row];
+            mask = entry->mask[shift][row];
+        } else {
+            uint32_t rowValue, rowMask;
+            loadRow(pixels, twoBits, flipY ? size - 1 - row : row, flipX, colors, rowValue, rowMask);
+            value = (uint64_t)rowValue << (2 * shift);
+            mask = (uint64_t)rowMask << (2 * shift);
+        }
+        merge(framebuffer + (dy * SCREEN_SIZE + x) / 4, bytes, value, mask);
+    }
+}
+
+} // namespace blitter
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <span>
+#include <stddef.h>
+#include <stdint.h>
+
+// Whether the Renderer uses this instead of blitSub where it can; the Makefile passes its value in
+#ifndef SOFTWARE_BLIT
+#define SOFTWARE_BLIT 1
+#endif
+
+// Software replacement for blitSub on 16x16 1bpp and 2bpp sprite frames, writing
+// straight into the framebuffer (4 pixels per byte, leftmost in the low bits).
+// A sprite row is remapped through DRAW_COLORS and flipped into 32 bit value
+// and mask words, which are shifted to the pixel alignment and merged into the
+// 4 or 5 framebuffer bytes under them in one 64 bit read-modify-write.
+namespace blitter {
+
+// A frame remapped and flipped for one DRAW_COLORS value, pre-shifted for
+// each of the 4 pixel alignments within a framebuffer byte
+struct Preshifted {
+    // frame | flip flags << 12 | DRAW_COLORS << 14, 0 for an empty entry
+    uint32_t key;
+    uint32_t lastUse;
+    uint64_t value[4][16];
+    uint64_t mask[4][16];
+};
+
+/// @brief whether drawSprite() handles this blit; it clips rows but not columns
+bool canDraw(int x, uint32_t flags);
+
+/// @brief draw a 16x16 frame like blitSub would
+/// @param pixels the frame on its own, 2 bytes per row at 1bpp and 4 at 2bpp (BLIT_2BPP in `flags`)
+/// @param frame identifies `pixels` in the cache
+/// @param cache pre-shifted frames to use and fill, least recently used ones are replaced; may be empty
+void drawSprite(uint8_t* framebuffer, const uint8_t* pixels, int frame, int x, int y, uint32_t flags, uint16_t colors,
+                std::span<Preshifted> cache);
+
+/// @brief draw a line of text from an 8 pixel wide 1bpp glyph strip like text() would, ink in draw color 1
+/// @param first character of the first glyph in `font`
+/// @return false, without drawing anything, if a character has no glyph
+bool drawText(uint8_t* framebuffer, const uint8_t* font, char first, int glyphs, const char* text, size_t length,
+              int x, int y, uint16_t colors);
+
+} // namespace blitter
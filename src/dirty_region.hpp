@@ -0,0 +1,118 @@
+#pragma once
+
+#include "math.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stdint.h>
+
+// Screen area that has to be redrawn, kept as one bitmask of cellSize wide
+// cells per row of cells. Rects are padded by a pixel on each side so that
+// rounding positions to pixels can never leave a stale pixel behind.
+template <int width, int height, int cellSize = 8>
+struct DirtyRegion {
+    static constexpr int columns = (width + cellSize - 1) / cellSize;
+    static constexpr int rows = (height + cellSize - 1) / cellSize;
+
+    static_assert(columns <= 32, "a row of cells must fit in a uint32_t");
+
+    uint32_t cells[(size_t)rows];
+
+    void reset() {
+        std::fill(std::begin(cells), std::end(cells), 0u);
+    }
+
+    void markAll() {
+        std::fill(std::begin(cells), std::end(cells), rowMask(0, columns - 1));
+    }
+
+    void mark(const Rect& rect) {
+        forEachRow(rect, [&](int row, uint32_t mask) {
+            cells[row] |= mask;
+            return true;
+        });
+    }
+
+    void mark(const DirtyRegion& other) {
+        for (int row = 0; row < rows; row++) {
+            cells[row] |= other.cells[row];
+        }
+    }
+
+    /// @brief whether any cell under `rect` is dirty
+    bool touches(const Rect& rect) const {
+        bool touched = false;
+        forEachRow(rect, [&](int row, uint32_t mask) {
+            touched = (cells[row] & mask) != 0;
+            return !touched;
+        });
+        return touched;
+    }
+
+    /// @brief whether every on-screen cell under `rect` is dirty; false if `rect` is off screen
+    bool covers(const Rect& rect) const {
+        bool visible = false;
+        bool covered = true;
+        forEachRow(rect, [&](int row, uint32_t mask) {
+            visible = true;
+            covered = (cells[row] & mask) == mask;
+            return covered;
+        });
+        return visible && covered;
+    }
+
+    bool empty() const {
+        return std::all_of(std::begin(cells), std::end(cells), [](uint32_t row) { return row == 0; });
+    }
+
+    /// @brief call `fn(x, y, w, h)` with the pixel bounds of every horizontal run of dirty cells
+    template <typename Fn>
+    void forEachRun(Fn&& fn) const {
+        for (int row = 0; row < rows; row++) {
+            const uint32_t bits = cells[row];
+            int column = 0;
+            while (column < columns) {
+                if (!(bits & (1u << column))) {
+                    column++;
+                    continue;
+                }
+                const int first = column;
+                while (column < columns && (bits & (1u << column))) {
+                    column++;
+                }
+                const int y = row * cellSize;
+                fn(first * cellSize, y, (std::min(column * cellSize, width) - first * cellSize),
+                   (std::min(y + cellSize, height) - y));
+            }
+        }
+    }
+
+  private:
+    static constexpr uint32_t rowMask(int first, int last) {
+        const uint32_t upTo = last >= 31 ? ~0u : (1u << (last + 1)) - 1u;
+        return upTo & ~((1u << first) - 1u);
+    }
+
+    // Calls fn(row, mask) for the rows of cells under rect, clamped to the screen
+    template <typename Fn>
+    static void forEachRow(const Rect& rect, Fn&& fn) {
+        const int left = (int)rect.left() - 1;
+        const int top = (int)rect.top() - 1;
+        const int right = (int)rect.right() + 1;
+        const int bottom = (int)rect.bottom() + 1;
+        if (right < 0 || bottom < 0 || left >= width || top >= height) {
+            return;
+        }
+
+        const int x0 = std::max(left, 0) / cellSize;
+        const int x1 = std::min(right, width - 1) / cellSize;
+        const int y0 = std::max(top, 0) / cellSize;
+        const int y1 = std::min(bottom, height - 1) / cellSize;
+        const uint32_t mask = rowMask(x0, x1);
+        for (int row = y0; row <= y1; row++) {
+            if (!fn(row, mask)) {
+                return;
+            }
+        }
+    }
+};
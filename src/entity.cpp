@@ -1,6 +1,8 @@
 #include "entity.hpp"
 #include "wasm4.h"
 
+#include <algorithm>
+
 void Entity::Input::updateForGamepad(uint8_t gamepad) {
     up = gamepad & BUTTON_UP;
     left = gamepad & BUTTON_LEFT;
@@ -9,6 +11,10 @@ void Entity::Input::updateForGamepad(uint8_t gamepad) {
     secondaryAction = gamepad & BUTTON_2;
 }
 
+bool Entity::Input::active() const {
+    return left != right || up || primaryAction || secondaryAction;
+}
+
 void Entity::update() {
 }
 
@@ -19,13 +25,31 @@ void Entity::render(Renderer& renderer) const {
     renderer.drawSpriteFrame(sprite, (int)bounds.origin.x, (int)bounds.origin.y, directionX < 0);
 }
 
-void Projectile::update() {
-    previousPosition = position;
-    position += velocity;
+Rect Entity::drawBounds() const {
+    return {bounds.origin, {16, 16}};
 }
 
-void Projectile::render(Renderer& renderer) const {
-    renderer.draw(previousPosition, position);
+Rect Projectile::bounds(const Vec2& from, const Vec2& to) {
+    const Vec2 min = {std::min(from.x, to.x), std::min(from.y, to.y)};
+    const Vec2 max = {std::max(from.x, to.x), std::max(from.y, to.y)};
+    return {min, {max.x - min.x, max.y - min.y}};
+}
+
+void Projectile::update(std::span<Vec2> positions, std::span<Vec2> previousPositions,
+                        std::span<const Vec2> velocities) {
+    for (size_t i = 0; i < positions.size(); i++) {
+        previousPositions[i] = positions[i];
+        positions[i] += velocities[i];
+    }
+}
+
+void Projectile::render(Renderer& renderer, std::span<const Vec2> positions,
+                        std::span<const Vec2> previousPositions) {
+    for (size_t i = 0; i < positions.size(); i++) {
+        if (renderer.needsDraw(bounds(previousPositions[i], positions[i]))) {
+            renderer.draw(previousPositions[i], positions[i]);
+        }
+    }
 }
 
 void Tile::update() {
@@ -34,3 +58,7 @@ void Tile::update() {
 void Tile::render(Renderer& renderer) const {
     renderer.drawSpriteFrame(sprite, (int)bounds.origin.x, (int)bounds.origin.y);
 }
+
+Rect Tile::drawBounds() const {
+    return {bounds.origin, {16, 16}};
+}
@@ -2,6 +2,9 @@
 
 #include "math.hpp"
 #include "renderer.hpp"
+#include "soa_pool.hpp"
+
+#include <span>
 
 struct Entity {
     // private:
@@ -18,6 +21,8 @@ struct Entity {
         bool secondaryAction;
 
         void updateForGamepad(uint8_t gamepad);
+        // Whether the input asks the entity to move or act
+        bool active() const;
     } input;
 
     struct Collisions {
@@ -38,21 +43,43 @@ struct Entity {
     bool visible = true;
     int invulnerable = 0;
 
+    // Bodies that stand still without input for sleepAfter frames stop
+    // integrating and colliding until something wakes them
+    static constexpr int sleepAfter = 30;
+    int restFrames = 0;
+    bool asleep = false;
+
+    void wake() {
+        restFrames = 0;
+        asleep = false;
+    }
+
     void update();
     void render(Renderer& renderer) const;
+    // Area touched by render()
+    Rect drawBounds() const;
 };
 
+// Projectiles are kept in a SoaPool, one array per field, so the per-frame
+// passes only stream the fields they need.
 struct Projectile {
-    int team;
-    Vec2 position;
-    Vec2 velocity;
-    bool active;
+    enum Field : size_t {
+        Team,
+        Position,
+        PreviousPosition,
+        Velocity
+    };
 
-    void update();
-    void render(Renderer& renderer) const;
+    template <size_t size>
+    using Pool = SoaPool<size, int, Vec2, Vec2, Vec2>;
+
+    /// @brief bounding rect of the segment travelled in a frame
+    static Rect bounds(const Vec2& from, const Vec2& to);
 
-  private:
-    Vec2 previousPosition;
+    static void update(std::span<Vec2> positions, std::span<Vec2> previousPositions,
+                       std::span<const Vec2> velocities);
+    static void render(Renderer& renderer, std::span<const Vec2> positions,
+                       std::span<const Vec2> previousPositions);
 };
 
 struct Tile {
@@ -61,4 +88,6 @@ struct Tile {
 
     void update();
     void render(Renderer& renderer) const;
+    // Area touched by render(), half height tiles still draw a full sprite
+    Rect drawBounds() const;
 };
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+#include <type_traits>
+
+// Signed fixed-point number with `fractionBits` bits below the binary point.
+// Arithmetic is done purely on integers, so results are bit-exact on every
+// platform. Construction from int/float is implicit to keep existing literal
+// heavy code working; converting back out always needs a cast.
+template <typename Storage, int fractionBits>
+struct Fixed {
+    static_assert(std::is_signed_v<Storage> && std::is_integral_v<Storage>);
+
+    using Wide = std::conditional_t<(sizeof(Storage) < 4), int32_t, int64_t>;
+
+    static constexpr Wide one = Wide(1) << fractionBits;
+    static constexpr Wide maxRaw = (Wide(1) << (sizeof(Storage) * 8 - 1)) - 1;
+    static constexpr Wide minRaw = -maxRaw - 1;
+
+    Storage raw;
+
+    constexpr Fixed() = default;
+    constexpr Fixed(int i) : raw((Storage)(i * one)) {
+    }
+    constexpr Fixed(float f) : raw((Storage)(f * (float)one)) {
+    }
+
+    static constexpr Fixed fromRaw(Wide value) {
+        Fixed out;
+        out.raw = (Storage)(value < minRaw ? minRaw : (value > maxRaw ? maxRaw : value));
+        return out;
+    }
+
+    // Truncates towards zero like a float to int cast
+    template <typename T>
+    explicit constexpr operator T() const {
+        if constexpr (std::is_floating_point_v<T>) {
+            return (T)raw / (T)one;
+        } else {
+            return (T)((Wide)raw / one);
+        }
+    }
+
+    constexpr Fixed operator-() const {
+        return fromRaw(-(Wide)raw);
+    }
+
+    constexpr Fixed& operator+=(const Fixed& other) {
+        return *this = *this + other;
+    }
+    constexpr Fixed& operator-=(const Fixed& other) {
+        return *this = *this - other;
+    }
+    constexpr Fixed& operator*=(const Fixed& other) {
+        return *this = *this * other;
+    }
+    constexpr Fixed& operator/=(const Fixed& other) {
+        return *this = *this / other;
+    }
+
+    friend constexpr Fixed operator+(const Fixed& a, const Fixed& b) {
+        return fromRaw((Wide)a.raw + b.raw);
+    }
+    friend constexpr Fixed operator-(const Fixed& a, const Fixed& b) {
+        return fromRaw((Wide)a.raw - b.raw);
+    }
+    friend constexpr Fixed operator*(const Fixed& a, const Fixed& b) {
+        return fromRaw(((Wide)a.raw * b.raw) / one);
+    }
+    // Saturates, including division by zero
+    friend constexpr Fixed operator/(const Fixed& a, const Fixed& b) {
+        if (b.raw == 0) {
+            return fromRaw(a.raw < 0 ? minRaw : maxRaw);
+        }
+        return fromRaw(((Wide)a.raw * one) / b.raw);
+    }
+
+    friend constexpr bool operator==(const Fixed& a, const Fixed& b) {
+        return a.raw == b.raw;
+    }
+    friend constexpr bool operator!=(const Fixed& a, const Fixed& b) {
+        return a.raw != b.raw;
+    }
+    friend constexpr bool operator<(const Fixed& a, const Fixed& b) {
+        return a.raw < b.raw;
+    }
+    friend constexpr bool operator>(const Fixed& a, const Fixed& b) {
+        return a.raw > b.raw;
+    }
+    friend constexpr bool operator<=(const Fixed& a, const Fixed& b) {
+        return a.raw <= b.raw;
+    }
+    friend constexpr bool operator>=(const Fixed& a, const Fixed& b) {
+        return a.raw >= b.raw;
+    }
+};
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "assets.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A decoded 16x16 frame is 16 rows of 2 bytes at 1bpp or of 4 bytes at 2bpp,
+// packed like WASM-4 sprites with the leftmost pixel in the high bits
+constexpr int maxFrameBytes = assets::tilemapFrameBytes;
+
+// Frame ids from assets::atlasFrame() are a stored frame in the low bits and
+// the BLIT_FLIP_X / BLIT_FLIP_Y that turn it into the referenced frame above
+constexpr int frameFlipShift = 12;
+
+inline int storedFrame(int id) {
+    return id & ((1 << frameFlipShift) - 1);
+}
+
+inline uint32_t frameFlips(int id) {
+    return (uint32_t)id >> frameFlipShift;
+}
+
+// Set in the format of frames stored at 1bpp
+constexpr uint8_t oneBitFrame = 0x10;
+
+inline bool isOneBitFrame(int index) {
+    return assets::tilemapFrameFormats[index] & oneBitFrame;
+}
+
+inline int frameBytes(int index) {
+    return isOneBitFrame(index) ? 16 * 16 / 8 : 16 * 16 / 4;
+}
+
+/// @brief DRAW_COLORS for 1bpp frame `index` that draw it the way `colors` draws the 2bpp original
+inline uint16_t oneBitColors(int index, uint16_t colors) {
+    const uint8_t format = assets::tilemapFrameFormats[index];
+    const int zero = format & 0x3;
+    const int one = (format >> 2) & 0x3;
+    return (uint16_t)(((colors >> (4 * zero)) & 0xf) | ((colors >> (4 * one)) & 0xf) << 4);
+}
+
+/// @brief palette index of pixel (x, y) of decoded frame `index`, as it is on the 2bpp sheet
+inline int framePixel(int index, const uint8_t* pixels, int x, int y) {
+    const uint8_t format = assets::tilemapFrameFormats[index];
+    if (format & oneBitFrame) {
+        const int bit = (pixels[y * 2 + x / 8] >> (7 - x % 8)) & 1;
+        return (format >> (2 * bit)) & 0x3;
+    }
+    const int src = y * 16 + x;
+    return (pixels[src / 4] >> (6 - 2 * (src % 4))) & 0x3;
+}
+
+/// @brief decompress frame `index` of the sprite sheet, the format is described in tools/compress_tilemap.py
+inline void decodeFrame(int index, uint8_t* out) {
+    const uint8_t* in = assets::tilemapData + assets::tilemapOffsets[index];
+    const int bytes = frameBytes(index);
+    int size = 0;
+    while (size < bytes) {
+        const uint8_t flags = *in++;
+        for (int bit = 0; bit < 8 && size < bytes; bit++) {
+            const uint8_t item = *in++;
+            if (!(flags & (1 << bit))) {
+                out[size++] = item;
+                continue;
+            }
+            const int offset = (item >> 4) + 1;
+            for (int length = (item & 0xf) + 2; length > 0; length--, size++) {
+                out[size] = out[size - offset];
+            }
+        }
+    }
+}
+
+// Frames decoded on first use, so that only the compressed sheet has to stay
+// in memory. The least recently used frame is replaced on a miss.
+template <size_t capacity>
+struct FrameCache {
+    struct Entry {
+        uint32_t lastUse;
+        uint16_t frame;
+        uint8_t pixels[maxFrameBytes];
+    };
+
+    struct Stats {
+        uint32_t hits;
+        uint32_t misses;
+    };
+
+    // Zero initialized entries have never been used
+    Entry entries[capacity];
+    uint32_t useCounter;
+
+    Stats stats;
+
+    /// @brief the pixels of frame `index`, valid until capacity other frames have been looked up
+    const uint8_t* get(int index) {
+        Entry* oldest = &entries[0];
+        for (auto& entry : entries) {
+            if (entry.lastUse != 0 && entry.frame == index) {
+                entry.lastUse = ++useCounter;
+                stats.hits++;
+                return entry.pixels;
+            }
+            if (entry.lastUse < oldest->lastUse) {
+                oldest = &entry;
+            }
+        }
+
+        stats.misses++;
+        decodeFrame(index, oldest->pixels);
+        oldest->frame = (uint16_t)index;
+        oldest->lastUse = ++useCounter;
+        return oldest->pixels;
+    }
+};
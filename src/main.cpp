@@ -4,14 +4,17 @@
 #include "assets.hpp"
 #include "entity.hpp"
 #include "math.hpp"
-#include "object_pool.hpp"
+#include "memory_budget.hpp"
+#include "palette_effects.hpp"
+#include "physics.hpp"
 #include "renderer.hpp"
+#include "tile_layer.hpp"
 #include "utils.hpp"
+#include "world.hpp"
+#include <algorithm>
 #include <array>
 #include <utility>
 
-float light = 0.0f;
-
 struct GameState {
     int health = 3;
     int score = 0;
@@ -21,15 +24,10 @@ struct GameState {
     } camera;
 };
 
-struct World {
-    const Rect bounds = {{0, 0}, {SCREEN_SIZE, SCREEN_SIZE}};
-    ObjectPool<Tile, 124> tiles;
-    ObjectPool<Entity, 100> entities;
-    ObjectPool<Projectile, 100> projectiles;
-};
-
 GameState state;
 World world;
+Physics physics;
+PaletteEffects paletteEffects;
 
 struct UpdateContext {
     int frame = 0;
@@ -37,31 +35,94 @@ struct UpdateContext {
 
 UpdateContext updateContext;
 
+// Everything large that lives in static data. `make budget` lists what the
+// linker actually placed; this keeps growing capacities honest at compile time.
+constexpr memory::Entry memoryBudget[] = {
+    {"world", sizeof(World)},
+    {"physics", sizeof(Physics)},
+    {"renderer", sizeof(Renderer)},
+    {"state", sizeof(GameState)},
+    {"tilemap", sizeof(assets::tilemapData) + sizeof(assets::tilemapOffsets)},
+    {"font", sizeof(assets::font)},
+    {"level", sizeof(assets::level)},
+    {"palette effects", sizeof(PaletteEffects) + sizeof(PaletteEffects::ramps)},
+};
+static_assert(memory::fits(memoryBudget), "static data does not fit in the 64 KB of linear memory");
+
+// The static tiles are pre-baked into one image when that fits next to
+// everything above, and drawn one by one otherwise
+using Grid = World::Grid;
+constexpr int tileLayerWidth = Grid::columns * Grid::tileSize;
+constexpr int tileLayerHeight = Grid::rows * Grid::tileSize;
+constexpr bool tileLayerFits =
+    memory::used(memoryBudget) + (size_t)(tileLayerWidth * tileLayerHeight / 4) <= memory::data;
+
+TileLayer<tileLayerFits ? tileLayerWidth : 0, tileLayerFits ? tileLayerHeight : 0> tileLayer;
+static_assert(memory::used(memoryBudget) + sizeof(tileLayer) <= memory::data,
+              "the tile layer does not fit in the 64 KB of linear memory");
+
+// Whatever is left keeps up to 8 sprites pre-shifted for the software blitter
+constexpr size_t spriteCacheSize =
+    SOFTWARE_BLIT ? std::min<size_t>(8, (memory::data - memory::used(memoryBudget) - sizeof(tileLayer)) /
+                                            sizeof(blitter::Preshifted))
+                  : 0;
+std::array<blitter::Preshifted, spriteCacheSize> spriteCache;
+
 class Gui {
   public:
-    void update(){};
+    // Screen areas touched by render()
+    static constexpr Rect healthArea = {{8, -1}, {16 * 3, 16}};
+    static constexpr Rect scoreArea = {{103, 0}, {SCREEN_SIZE - 103, 14}};
+
+    // The score is only formatted again when it changes
+    void update() {
+        if (state.score == textScore && scoreLength != 0) {
+            return;
+        }
+        // The span ends with the null terminator
+        const auto str = to_string(state.score, scoreText);
+        scoreLength = str.size() - 1;
+        scoreX = 103 + 8 + (5 - (int)scoreLength) * 8;
+        textScore = state.score;
+    };
     void render(Renderer& renderer) {
         renderer.setViewport(0, 0);
+        renderer.setLayer(Renderer::Layer::Hud);
 
-        renderer.useColor(0x0024);
-        renderer.draw({{8, 0}, {16 * 3, 14}});
-        renderer.draw({{104, 0}, {16 * 3, 14}});
+        if (renderer.needsDraw(healthArea)) {
+            renderer.useColor(0x0024);
+            renderer.draw({{8, 0}, {16 * 3, 14}});
 
-        renderer.useColor(2);
-        for (int i = 0; i < state.health; i++) {
-            renderer.drawSpriteFrame(assets::SpriteFrame::Hearth, 8 + 16 * i, -1);
+            renderer.useColor(2);
+            for (int i = 0; i < state.health; i++) {
+                renderer.drawSpriteFrame(assets::SpriteFrame::Hearth, 8 + 16 * i, -1);
+            }
         }
 
-        char buffer[8] = {'\0'};
-        auto str = to_string(state.score, buffer);
-        renderer.drawText({str.begin(), str.end()}, 103 + 8 + (6 - (int)str.size()) * 8, 4);
+        if (renderer.needsDraw(scoreArea)) {
+            renderer.useColor(0x0024);
+            renderer.draw({{104, 0}, {16 * 3, 14}});
+
+            renderer.useColor(2);
+            renderer.drawText({scoreText, scoreLength}, scoreX, 4);
+        }
+
+        drawnHealth = state.health;
+        drawnScore = state.score;
     };
-};
 
-class Physics {
-  public:
-    void update(){};
-    void render(){};
+    bool changed() const {
+        return state.health != drawnHealth || state.score != drawnScore;
+    }
+
+  private:
+    int drawnHealth = 0;
+    int drawnScore = 0;
+
+    char scoreText[8] = {'\0'};
+    size_t scoreLength = 0;
+    int scoreX = 0;
+    int textScore = 0;
 };
 
 #if !defined(X)
@@ -71,26 +132,36 @@ Gui gui;
 
 decltype(World::entities)::Handle player;
 
+void bakeTileLayer() {
+    if (!tileLayerFits) {
+        return;
+    }
+    tileLayer.origin = world.grid.origin;
+    tileLayer.clear(4);
+    for (const auto& t : world.tiles) {
+        tileLayer.drawSpriteFrame(t.sprite, (int)(t.bounds.origin.x - tileLayer.origin.x),
+                                  (int)(t.bounds.origin.y - tileLayer.origin.y), 0x0321);
+    }
+}
+
+// Call after changing tiles or cells in world.grid
+void rebuildCollision() {
+    world.grid.build();
+    bakeTileLayer();
+    renderer.invalidate();
+    // Anything resting on the old tiles has to re-check its support
+    for (auto& entity : world.entities) {
+        entity.wake();
+    }
+}
+
 void start() {
     {
-        int width = 10;
-        int height = 11;
-        int map[] = {
-            // clang-format off
-            219,316,316,317,  0,  0,315,316,316,239,
-            297,  0,  0,  0,  0,  0,  0,  0,  0,295,
-            297,  0,  0,  0,  0,  0,  0,  0,  0,295,
-            297,  0,  0, 84, 85, 85, 86,  0,  0,295,
-            297,  0,  0,  0,  0,  0,  0,  0,  0,295,
-            297,  0,  0,  0,  0,  0, 84, 85, 85,295,
-            297, 85, 85, 86,  0,  0,  0,  0,  0,295,
-            297,  0,  0,  0,  0,  0,  0,  0,  0,295,
-            297,  0,  0, 84, 85, 85, 86,  0,  0,295,
-            297,  0,  0,  0,  0,  0,  0,  0,  0,295,
-            199,276,276,277,  0,  0,275,276,276,259,
-            // clang-format on
-
-        };
+        const int width = assets::levelWidth;
+        const int height = assets::levelHeight;
+        static_assert(width == Grid::columns && height == Grid::rows, "the level does not match the tile grid");
+        const auto& map = assets::level;
+        world.grid.origin = {0, -8.0f};
         for (int x = 0; x < width; x++) {
             for (int y = 0; y < height; y++) {
                 const int type = map[y * width + x];
@@ -102,9 +173,11 @@ void start() {
                     h = 8;
                 }
                 // TODO: fix camera offset
-                world.tiles.create(Rect{{x * 16.f, y * 16.f - 8.0f}, {16, h}}, type);
+                world.tiles.create(Rect{{x * 16.f, y * 16.f - 8.0f}, {16, h}}, assets::atlasFrame(type));
+                world.grid.set(x, y, (int)h);
             }
         }
+        rebuildCollision();
     }
 
     player = world.entities.create(Entity{1,
@@ -117,45 +190,21 @@ void start() {
                                           nullptr,
                                           {assets::player_idle_animation, assets::player_walk_animation}});
 
+    paletteEffects.setBase(assets::palettes::lava_gb);
     renderer.setPalette(assets::palettes::lava_gb);
     renderer.useColor(0x4321);
-}
+    renderer.useSpriteCache(spriteCache);
 
-const float padding = 1.5f;
-void updateForCollisionX(Entity& entity, const Rect& rect) {
-    Rect e = entity.bounds;
-    e.origin.y += padding;
-    e.size.height -= padding * 2;
-    e.origin.x += entity.velocity.x;
-
-    if (e.collision(rect)) {
-        if (entity.velocity.x > 0) {
-            entity.velocity.x = 0;
-            entity.bounds.origin.x = rect.origin.x - e.size.width;
-            entity.collisions.right = true;
-        } else if (entity.velocity.x < 0) {
-            entity.velocity.x = 0;
-            entity.bounds.origin.x = rect.origin.x + rect.size.width;
-            entity.collisions.left = true;
-        }
-    }
+#if DIRTY_RECT_RENDERING
+    *SYSTEM_FLAGS |= SYSTEM_PRESERVE_FRAMEBUFFER;
+    renderer.invalidate();
+#endif
 }
 
-void updateForCollisionY(Entity& entity, const Rect& rect) {
-    Rect e = entity.bounds;
-    e.origin.x += padding;
-    e.size.width -= padding * 2;
-    e.origin.y += entity.velocity.y;
-    if (e.collision(rect)) {
-        if (entity.velocity.y > 0) {
-            entity.velocity.y = 0;
-            entity.bounds.origin.y = rect.origin.y - e.size.height;
-            entity.collisions.down = true;
-        } else if (entity.velocity.y < 0) {
-            entity.velocity.y = 0;
-            entity.bounds.origin.y = rect.origin.y + rect.size.height;
-            entity.collisions.up = true;
-        }
+void updateAnimation(Entity& entity) {
+    if (entity.animation && entity.animation[0] > 0) {
+        const int index = (updateContext.frame / 10 % entity.animation[0]) + 1;
+        entity.sprite = entity.animation[index];
     }
 }
 
@@ -173,8 +222,6 @@ void updateEntity(Entity& entity, World& world) {
 
     entity.visible = (entity.invulnerable % 8) < 4;
 
-    Rect& b = entity.bounds;
-    Vec2& o = entity.bounds.origin;
     Vec2& v = entity.velocity;
 
     int inputX = (entity.input.right ? 1 : 0) - (entity.input.left ? 1 : 0);
@@ -186,6 +233,14 @@ void updateEntity(Entity& entity, World& world) {
     }
     bool jump = (entity.input.up || entity.input.secondaryAction);
 
+    if (entity.asleep) {
+        if (!entity.input.active()) {
+            updateAnimation(entity);
+            return;
+        }
+        entity.wake();
+    }
+
     v.x = (v.x * (1 - acc)) + ((float)inputX * maxSpeed * acc);
     if (v.x < -maxSpeed) {
         v.x = -maxSpeed;
@@ -207,69 +262,41 @@ void updateEntity(Entity& entity, World& world) {
         }
     }
 
-    o += v;
-
-    if (b.top() >= world.bounds.bottom()) {
-        o.y -= world.bounds.height();
-    } else if (b.bottom() <= world.bounds.top()) {
-        o.y += world.bounds.height();
-    }
-
     if (entity.input.primaryAction && (lastPrimaryActionFrame + primaryActionInterval < updateContext.frame)) {
         lastPrimaryActionFrame = updateContext.frame;
-        light += 0.2f;
+        paletteEffects.play(PaletteEffects::Flash);
         for (int i = 0; i < 5; i++) {
-            auto handle = world.projectiles.alloc();
+            Vec2 position = entity.bounds.origin;
+            // position.x += entity.bounds.size.width / 2.0f;
+            if (entity.directionX > 0) {
+                position.x += entity.bounds.size.width;
+            }
+            position.y += entity.bounds.size.height / 2.0f;
+            Vec2 velocity = {(float)entity.directionX * 5.0f, math::random(-1.0f, 1.0f)};
+
+            auto handle = world.projectiles.create(entity.team, position, position, velocity);
             if (handle != world.projectiles.invalid_handle) {
-                auto& p = *world.projectiles.get(handle);
-                p.team = entity.team;
-                p.position = entity.bounds.origin;
-                // p.position.x += entity.bounds.size.width / 2.0f;
-                if (entity.directionX > 0) {
-                    p.position.x += entity.bounds.size.width;
-                }
-                p.position.y += entity.bounds.size.height / 2.0f;
-                p.velocity.x = (float)entity.directionX * 5.0f;
-                p.velocity.y = math::random(-1.0f, 1.0f);
-                state.camera.velocity += p.velocity * 0.1f;
-                p.active = true;
+                state.camera.velocity += velocity * 0.1f;
 
                 entity.velocity.x -= (float)entity.directionX * 0.1f;
             }
         }
     }
 
-    if (entity.animation && entity.animation[0] > 0) {
-        const int index = (updateContext.frame / 10 % entity.animation[0]) + 1;
-        entity.sprite = entity.animation[index];
-    }
-
-    entity.collisions = {false, false, false, false};
-    for (const auto& tile : world.tiles) {
-        updateForCollisionY(entity, tile.bounds);
-    }
-    for (const auto& tile : world.tiles) {
-        updateForCollisionX(entity, tile.bounds);
-    }
+    updateAnimation(entity);
 };
 
-Color c[4] = {{255, 255, 255, 255}, {255, 255, 255, 255}, {255, 255, 255, 255}, {255, 255, 255, 255}};
+// Frames between pool telemetry summaries in debug builds
+const int poolReportInterval = 60 * 5;
+
 void doUpdate() {
     updateContext.frame += 1;
     auto& camera = state.camera;
 
-    if (light > 0) {
-        light -= 1.0f / 30;
-        if (light < 0) {
-            light = 0;
-        }
-    }
-    Color white = {255, 255, 255, 255};
-    auto p = assets::palettes::lava_gb;
-    for (int i = 0; i < 4; i++) {
-        c[i] = p[i] * (1.0f - light) + white * (light);
+    uint32_t palette[4];
+    if (paletteEffects.update(palette)) {
+        renderer.setPalette(palette);
     }
-    renderer.setPalette(c);
 
     camera.position += camera.velocity;
     camera.velocity = camera.velocity * 0.9f - camera.position * 0.1f;
@@ -293,32 +320,15 @@ void doUpdate() {
     if (playerEntity) {
         const uint8_t gamepad = *GAMEPAD1;
         playerEntity->input.updateForGamepad(gamepad);
-
-        if (playerEntity->invulnerable <= 0) {
-            for (auto& entity : world.entities) {
-                if (&entity == playerEntity) {
-                    continue;
-                }
-
-                if (entity.bounds.collision(playerEntity->bounds)) {
-                    state.health -= 1;
-
-                    playerEntity->invulnerable = 45;
-                    bool left = entity.bounds.left() < playerEntity->bounds.left();
-
-                    playerEntity->velocity.x += left ? 5 : -5;
-
-                    if (state.health <= 0) {
-                        world.entities.free(player);
-                    }
-                    break;
-                }
-            }
-        }
     }
 
     for (auto& entity : world.entities) {
         updateEntity(entity, world);
+    }
+
+    physics.update(world);
+
+    for (auto& entity : world.entities) {
         if (entity.collisions.left) {
             entity.input.left = false;
             entity.input.right = true;
@@ -328,71 +338,167 @@ void doUpdate() {
         }
     }
 
-    for (auto& p : world.projectiles) {
-
-        p.update();
-        if (!world.bounds.contains(p.position)) {
-            world.projectiles.free(&p);
-            continue;
-        }
-
-        bool free = false;
-        for (auto& e : world.entities) {
-            if (e.team == p.team) {
+    if (playerEntity && playerEntity->invulnerable <= 0) {
+        for (const auto& contact : physics.contacts()) {
+            if (contact.a != playerEntity && contact.b != playerEntity) {
                 continue;
             }
-            if (e.bounds.contains(p.position)) {
-                world.projectiles.free(&p);
-                world.entities.free(&e);
-                free = true;
-                state.score += 25;
-                break;
-            }
-        }
+            Entity* entity = contact.a == playerEntity ? contact.b : contact.a;
+
+            state.health -= 1;
+
+            playerEntity->wake();
+            entity->wake();
+            playerEntity->invulnerable = 45;
+            paletteEffects.play(PaletteEffects::DamageBlink);
+            bool left = entity->bounds.left() < playerEntity->bounds.left();
 
-        for (const auto& tile : world.tiles) {
-            if (tile.bounds.contains(p.position)) {
-                world.projectiles.free(&p);
-                free = true;
-                break;
+            playerEntity->velocity.x += left ? 5 : -5;
+
+            if (state.health <= 0) {
+                world.entities.deferFree(player);
+                paletteEffects.play(PaletteEffects::FadeToBlack);
             }
+            break;
         }
+    }
 
-        if (free) {
-            continue;
+    for (const auto& hit : physics.projectileHits()) {
+        if (hit.target && world.entities.deferFree(hit.target)) {
+            state.score += 25;
         }
+        world.projectiles.deferFree(hit.projectile);
+    }
+
+    world.entities.flush();
+    world.projectiles.flush();
+
+    world.tiles.stats.endFrame();
+    world.entities.stats.endFrame();
+    world.projectiles.stats.endFrame();
+
+#if defined(DEBUG)
+    if (updateContext.frame % poolReportInterval == 0) {
+        world.tiles.stats.report("tiles", world.tiles.capacity);
+        world.entities.stats.report("entities", world.entities.capacity);
+        world.projectiles.stats.report("projectiles", world.projectiles.capacity);
+        physics.report();
+        renderer.report();
     }
+#endif
 
     gui.update();
 }
 
+// Palette swatches in the bottom left corner, in screen space
+const Rect paletteArea = {{0, 159}, {4, 1}};
+
+#if DIRTY_RECT_RENDERING
+int viewportX = 0;
+int viewportY = 0;
+
+// Marks what changed since the last frame, then grows the dirty area until
+// everything that touches it lies wholly inside. Objects are always redrawn
+// whole, so this keeps them from painting over pixels that were not cleared.
+void invalidateChanges() {
+    const int x = (int)state.camera.position.x;
+    const int y = (int)state.camera.position.y;
+    if (x != viewportX || y != viewportY) {
+        viewportX = x;
+        viewportY = y;
+        renderer.invalidate();
+    }
+
+    const auto positions = world.projectiles.field<Projectile::Position>();
+    const auto previousPositions = world.projectiles.field<Projectile::PreviousPosition>();
+    for (size_t i = 0; i < positions.size(); i++) {
+        renderer.invalidateMoving(Projectile::bounds(previousPositions[i], positions[i]));
+    }
+    for (const auto& entity : world.entities) {
+        renderer.invalidateMoving(entity.drawBounds());
+    }
+
+    // Screen space areas are moved into world space to go through the viewport
+    const Vec2 viewport = {(Scalar)x, (Scalar)y};
+    const Rect screenAreas[] = {
+        {Gui::healthArea.origin + viewport, Gui::healthArea.size},
+        {Gui::scoreArea.origin + viewport, Gui::scoreArea.size},
+        {paletteArea.origin + viewport, paletteArea.size},
+    };
+    if (gui.changed()) {
+        renderer.invalidate(screenAreas[0]);
+        renderer.invalidate(screenAreas[1]);
+    }
+
+    bool grew = true;
+    while (grew) {
+        grew = false;
+        // The tile layer is drawn clipped to the dirty cells, only single tiles have to be whole
+        if (!tileLayerFits) {
+            for (const auto& t : world.tiles) {
+                grew = renderer.include(t.drawBounds()) || grew;
+            }
+        }
+        for (size_t i = 0; i < positions.size(); i++) {
+            grew = renderer.include(Projectile::bounds(previousPositions[i], positions[i])) || grew;
+        }
+        for (const auto& entity : world.entities) {
+            grew = renderer.include(entity.drawBounds()) || grew;
+        }
+        for (const auto& area : screenAreas) {
+            grew = renderer.include(area) || grew;
+        }
+    }
+}
+#endif
+
 void doRender() {
     renderer.useColor(0x0321);
-    renderer.clear(4);
     renderer.setViewport(state.camera.position.x, state.camera.position.y);
-
-    for (const auto& t : world.tiles) {
-        t.render(renderer);
+#if DIRTY_RECT_RENDERING
+    invalidateChanges();
+#endif
+    renderer.beginFrame(4);
+
+    renderer.setLayer(Renderer::Layer::Tiles);
+    if (tileLayerFits) {
+        renderer.drawLayer(tileLayer.pixels.data(), tileLayer.layerWidth, tileLayer.layerHeight, tileLayer.origin);
+    } else {
+        for (const auto& t : world.tiles) {
+            if (renderer.needsDraw(t.drawBounds())) {
+                t.render(renderer);
+            }
+        }
     }
 
-    for (const auto& p : world.projectiles) {
-        p.render(renderer);
-    }
+    renderer.setLayer(Renderer::Layer::Projectiles);
+    Projectile::render(renderer, world.projectiles.field<Projectile::Position>(),
+                       world.projectiles.field<Projectile::PreviousPosition>());
 
+    const Entity* playerEntity = world.entities.get(player);
     for (auto& entity : world.entities) {
-        entity.render(renderer);
+        // The player stays in front of enemies whatever order the pool is in
+        renderer.setLayer(Renderer::Layer::Entities, &entity == playerEntity ? 1 : 0);
+        if (renderer.needsDraw(entity.drawBounds())) {
+            entity.render(renderer);
+        }
     }
 
     gui.render(renderer);
 
-    renderer.useColor(1);
-    renderer.draw({{0, 159}, {1, 1}});
-    renderer.useColor(2);
-    renderer.draw({{1, 159}, {1, 1}});
-    renderer.useColor(3);
-    renderer.draw({{2, 159}, {1, 1}});
-    renderer.useColor(4);
-    renderer.draw({{3, 159}, {1, 1}});
+    if (renderer.needsDraw(paletteArea)) {
+        renderer.setLayer(Renderer::Layer::Debug);
+        renderer.useColor(1);
+        renderer.draw({{0, 159}, {1, 1}});
+        renderer.useColor(2);
+        renderer.draw({{1, 159}, {1, 1}});
+        renderer.useColor(3);
+        renderer.draw({{2, 159}, {1, 1}});
+        renderer.useColor(4);
+        renderer.draw({{3, 159}, {1, 1}});
+    }
+
+    renderer.endFrame();
 }
 
 void update() {
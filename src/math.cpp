@@ -1,7 +1,23 @@
 #include "math.hpp"
 
+#include <utility>
+
+// Vector kernels only apply to float rects; fixed point builds use the scalar loop
+#if !FIXED_POINT_MATH
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define COLLISION_SIMD_WASM
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#define COLLISION_SIMD_SSE
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define COLLISION_SIMD_NEON
+#endif
+#endif
+
 namespace {
-bool overlap(float aMin, float aMax, float bMin, float bMax) {
+bool overlap(Scalar aMin, Scalar aMax, Scalar bMin, Scalar bMax) {
     return !(aMax < bMin || aMin > bMax);
 }
 
@@ -16,6 +32,77 @@ bool overlapY(const Rect& a, const Rect& b) {
 bool collision(const Rect& a, const Rect& b) {
     return overlapY(a, b) && overlapX(a, b);
 }
+
+// Narrow [tMin, tMax] to where p + d * t lies within [min, max]
+bool clip(Scalar p, Scalar d, Scalar min, Scalar max, Scalar& tMin, Scalar& tMax) {
+    if (d == 0) {
+        return p >= min && p <= max;
+    }
+    Scalar t0 = (min - p) / d;
+    Scalar t1 = (max - p) / d;
+    if (t0 > t1) {
+        std::swap(t0, t1);
+    }
+    tMin = t0 > tMin ? t0 : tMin;
+    tMax = t1 < tMax ? t1 : tMax;
+    return tMin <= tMax;
+}
+
+#if defined(COLLISION_SIMD_WASM) || defined(COLLISION_SIMD_SSE) || defined(COLLISION_SIMD_NEON)
+static_assert(sizeof(Rect) == 4 * sizeof(float), "rects must load as one 4 lane vector");
+
+// Collision of `rect` with rects[0..3], one bit per rect
+uint32_t collisionMask4(const Rect& rect, const Rect* rects) {
+    const float* data = &rects->origin.x;
+#if defined(COLLISION_SIMD_WASM)
+    const v128_t r0 = wasm_v128_load(data);
+    const v128_t r1 = wasm_v128_load(data + 4);
+    const v128_t r2 = wasm_v128_load(data + 8);
+    const v128_t r3 = wasm_v128_load(data + 12);
+    // Transpose {x, y, w, h} x 4 into xs, ys, ws, hs
+    const v128_t xy01 = wasm_i32x4_shuffle(r0, r1, 0, 4, 1, 5);
+    const v128_t xy23 = wasm_i32x4_shuffle(r2, r3, 0, 4, 1, 5);
+    const v128_t wh01 = wasm_i32x4_shuffle(r0, r1, 2, 6, 3, 7);
+    const v128_t wh23 = wasm_i32x4_shuffle(r2, r3, 2, 6, 3, 7);
+    const v128_t xs = wasm_i32x4_shuffle(xy01, xy23, 0, 1, 4, 5);
+    const v128_t ys = wasm_i32x4_shuffle(xy01, xy23, 2, 3, 6, 7);
+    const v128_t rights = wasm_f32x4_add(xs, wasm_i32x4_shuffle(wh01, wh23, 0, 1, 4, 5));
+    const v128_t bottoms = wasm_f32x4_add(ys, wasm_i32x4_shuffle(wh01, wh23, 2, 3, 6, 7));
+
+    const v128_t x = wasm_v128_and(wasm_f32x4_ge(rights, wasm_f32x4_splat(rect.left())),
+                                   wasm_f32x4_le(xs, wasm_f32x4_splat(rect.right())));
+    const v128_t y = wasm_v128_and(wasm_f32x4_ge(bottoms, wasm_f32x4_splat(rect.top())),
+                                   wasm_f32x4_le(ys, wasm_f32x4_splat(rect.bottom())));
+    return (uint32_t)wasm_i32x4_bitmask(wasm_v128_and(x, y));
+#elif defined(COLLISION_SIMD_SSE)
+    __m128 xs = _mm_loadu_ps(data);
+    __m128 ys = _mm_loadu_ps(data + 4);
+    __m128 ws = _mm_loadu_ps(data + 8);
+    __m128 hs = _mm_loadu_ps(data + 12);
+    _MM_TRANSPOSE4_PS(xs, ys, ws, hs);
+    const __m128 rights = _mm_add_ps(xs, ws);
+    const __m128 bottoms = _mm_add_ps(ys, hs);
+
+    const __m128 x = _mm_and_ps(_mm_cmpge_ps(rights, _mm_set1_ps(rect.left())),
+                                _mm_cmple_ps(xs, _mm_set1_ps(rect.right())));
+    const __m128 y = _mm_and_ps(_mm_cmpge_ps(bottoms, _mm_set1_ps(rect.top())),
+                                _mm_cmple_ps(ys, _mm_set1_ps(rect.bottom())));
+    return (uint32_t)_mm_movemask_ps(_mm_and_ps(x, y));
+#elif defined(COLLISION_SIMD_NEON)
+    // vld4q de-interleaves {x, y, w, h} x 4 on load
+    const float32x4x4_t r = vld4q_f32(data);
+    const float32x4_t rights = vaddq_f32(r.val[0], r.val[2]);
+    const float32x4_t bottoms = vaddq_f32(r.val[1], r.val[3]);
+
+    const uint32x4_t x = vandq_u32(vcgeq_f32(rights, vdupq_n_f32(rect.left())),
+                                   vcleq_f32(r.val[0], vdupq_n_f32(rect.right())));
+    const uint32x4_t y = vandq_u32(vcgeq_f32(bottoms, vdupq_n_f32(rect.top())),
+                                   vcleq_f32(r.val[1], vdupq_n_f32(rect.bottom())));
+    const uint32x4_t bits = {1, 2, 4, 8};
+    return vaddvq_u32(vandq_u32(vandq_u32(x, y), bits));
+#endif
+}
+#endif
 } // namespace
 
 bool Rect::contains(const Vec2& p) const {
@@ -26,6 +113,34 @@ bool Rect::collision(const Rect& other) const {
     return ::collision(*this, other);
 }
 
+bool Rect::raycast(const Vec2& from, const Vec2& to, value_type& t) const {
+    value_type tMin = 0;
+    value_type tMax = 1;
+    if (!clip(from.x, to.x - from.x, left(), right(), tMin, tMax) ||
+        !clip(from.y, to.y - from.y, top(), bottom(), tMin, tMax)) {
+        return false;
+    }
+    t = tMin;
+    return true;
+}
+
+uint32_t math::collisionMask(const Rect& rect, const Rect* rects, size_t count) {
+    count = count > 32 ? 32 : count;
+    uint32_t mask = 0;
+    size_t i = 0;
+#if defined(COLLISION_SIMD_WASM) || defined(COLLISION_SIMD_SSE) || defined(COLLISION_SIMD_NEON)
+    for (; i + 4 <= count; i += 4) {
+        mask |= collisionMask4(rect, rects + i) << i;
+    }
+#endif
+    for (; i < count; i++) {
+        if (::collision(rect, rects[i])) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
 float math::random() {
     return static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
 };
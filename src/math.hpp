@@ -1,10 +1,23 @@
 #pragma once
 
 #include <cstdlib>
+#include <stddef.h>
 #include <stdint.h>
 
+#include "fixed.hpp"
+
+// Scalar used for positions and sizes. Build with -DFIXED_POINT_MATH=32 for
+// Q16.16 or =16 for Q12.4 to get a deterministic integer simulation.
+#if FIXED_POINT_MATH == 32
+using Scalar = Fixed<int32_t, 16>;
+#elif FIXED_POINT_MATH == 16
+using Scalar = Fixed<int16_t, 4>;
+#else
+using Scalar = float;
+#endif
+
 struct Vec2 {
-    using value_type = float;
+    using value_type = Scalar;
 
     value_type x;
     value_type y;
@@ -48,7 +61,7 @@ struct Vec2 {
 };
 
 struct Size {
-    using value_type = float;
+    using value_type = Scalar;
 
     value_type width;
     value_type height;
@@ -81,6 +94,9 @@ struct Rect {
 
     bool contains(const Vec2& p) const;
     bool collision(const Rect& other) const;
+    /// @brief test the segment from -> to against the rect
+    /// @param t set to where the segment enters the rect, 0 at `from` and 1 at `to`
+    bool raycast(const Vec2& from, const Vec2& to, value_type& t) const;
 };
 
 struct Color {
@@ -162,4 +178,8 @@ namespace math {
 float random();
 
 float random(float min, float max);
+
+/// @brief test `rect` against up to 32 packed rects, 4 at a time where SIMD is available
+/// @return bit i set when rects[i] collides with `rect`, with the same edge rules as Rect::collision
+uint32_t collisionMask(const Rect& rect, const Rect* rects, size_t count);
 } // namespace math
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+
+// Sizes baked into the linker flags; the Makefile passes its values in.
+#ifndef WASM_MEMORY_SIZE
+#define WASM_MEMORY_SIZE 65536
+#endif
+#ifndef WASM_STACK_SIZE
+#define WASM_STACK_SIZE 14752
+#endif
+
+// Layout of the cart's linear memory with --stack-first:
+//   [0, reservedEnd)      WASM-4 registers and framebuffer
+//   [reservedEnd, stackTop) stack, growing down towards the framebuffer
+//   [stackTop, size)      static data, read-only assets and heap
+namespace memory {
+
+constexpr size_t size = WASM_MEMORY_SIZE;
+constexpr size_t framebuffer = 0xa0;
+constexpr size_t framebufferSize = 160 * 160 / 4;
+constexpr size_t reservedEnd = framebuffer + framebufferSize;
+constexpr size_t stackTop = WASM_STACK_SIZE;
+constexpr size_t stack = stackTop - reservedEnd;
+constexpr size_t data = size - stackTop;
+
+static_assert(stackTop > reservedEnd, "the stack overlaps the WASM-4 framebuffer");
+static_assert(stackTop < size, "the stack does not fit in linear memory");
+
+struct Entry {
+    const char* name;
+    size_t size;
+};
+
+template <size_t N>
+constexpr size_t used(const Entry (&entries)[N]) {
+    size_t total = 0;
+    for (const auto& entry : entries) {
+        total += entry.size;
+    }
+    return total;
+}
+
+template <size_t N>
+constexpr bool fits(const Entry (&entries)[N]) {
+    return used(entries) <= data;
+}
+
+} // namespace memory
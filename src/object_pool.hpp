@@ -1,9 +1,19 @@
 #pragma once
 
 #include <algorithm>
+#include <iterator>
 #include <stddef.h>
 
-template <typename T, size_t size = 100>
+#include "pool_stats.hpp"
+
+enum class PoolIteration {
+    // Walk every slot that has been handed out and skip the dead ones.
+    Scan,
+    // Keep a packed array of live indices (sparse set) and walk only those.
+    Packed
+};
+
+template <typename T, size_t size = 100, PoolIteration iteration = PoolIteration::Scan>
 struct ObjectPool {
     using Handle = uint32_t;
     const static Handle invalid_handle = 0;
@@ -33,32 +43,96 @@ struct ObjectPool {
         }
     };
 
+    // Walks the live indices from the back, so freeing the current object
+    // only moves an already visited index into its place.
+    struct PackedIterator {
+        Slot* objects;
+        const uint16_t* ptr;
+
+        T& operator*() const {
+            return objects[*(ptr - 1)].object;
+        }
+        bool operator!=(const PackedIterator& b) const {
+            return ptr != b.ptr;
+        }
+
+        PackedIterator& operator++() {
+            ptr--;
+            return *this;
+        }
+    };
+
+    static constexpr size_t capacity = size;
+    static constexpr bool packed = iteration == PoolIteration::Packed;
+    static constexpr size_t liveCapacity = packed ? size : 1;
+
+    static_assert(size <= 0xffff, "slot index must fit in the lower half of a handle");
+
     Slot objects[size];
 
-    Iterator begin() {
-        auto begin = std::begin(objects);
-        auto end = std::end(objects);
-        Iterator it{begin - 1, begin, end};
-        return ++it;
+    // Indices of freed slots, used as a stack. Slots at or above `used` have
+    // never been handed out and are taken in order once the stack is empty.
+    uint16_t freeIndices[size];
+    uint16_t freeCount;
+    uint16_t used;
+
+    // Packed mode only: live slot indices, and the position of each slot in it.
+    uint16_t live[liveCapacity];
+    uint16_t livePosition[liveCapacity];
+    uint16_t liveCount;
+
+    // Frees requested with deferFree(), applied in one batch by flush().
+    Handle pending[size];
+    uint16_t pendingCount;
+    uint8_t pendingBits[(size + 7) / 8];
+
+    PoolStats stats;
+
+    auto begin() {
+        stats.onScan(packed ? liveCount : used);
+        if constexpr (packed) {
+            return PackedIterator{objects, live + liveCount};
+        } else {
+            auto begin = std::begin(objects);
+            auto end = begin + used;
+            Iterator it{begin - 1, begin, end};
+            return ++it;
+        }
     }
-    Iterator end() {
-        auto begin = std::begin(objects);
-        auto end = std::end(objects);
-        return {end, begin, end};
+    auto end() {
+        if constexpr (packed) {
+            return PackedIterator{objects, live};
+        } else {
+            auto begin = std::begin(objects);
+            auto end = begin + used;
+            return Iterator{end, begin, end};
+        }
+    }
+
+    size_t count() const {
+        return liveCount;
     }
 
     Handle alloc() {
-        auto begin = std::begin(objects);
-        auto end = std::end(objects);
-        auto slot = std::find_if(std::begin(objects), std::end(objects),
-                                 [](const Slot& slot) { return (slot.check & 0x1) == 0; });
-        if (slot == std::end(objects)) {
-            trace("no available object in pool");
+        uint16_t index;
+        if (freeCount > 0) {
+            index = freeIndices[--freeCount];
+        } else if (used < size) {
+            index = used++;
+        } else {
+            stats.onAllocFailure();
             return invalid_handle;
         }
 
-        uint16_t check = slot->check = slot->check + 1;
-        uint16_t index = (uint16_t)std::distance(begin, slot);
+        Slot& slot = objects[index];
+        uint16_t check = slot.check = (uint16_t)(slot.check + 1);
+
+        if constexpr (packed) {
+            live[liveCount] = index;
+            livePosition[index] = liveCount;
+        }
+        liveCount++;
+        stats.onAlloc(liveCount);
 
         return (Handle)(check << 16 | index);
     };
@@ -90,29 +164,51 @@ struct ObjectPool {
     }
 
     void free(T* obj) {
-        const char* ptr = reinterpret_cast<const char*>(obj);
-        const char* first = reinterpret_cast<const char*>(&std::begin(objects)->object);
-
-        if (ptr < first) {
-            return;
+        int i = indexOf(obj);
+        if (i >= 0) {
+            release((uint16_t)i);
         }
+    };
 
-        auto s = sizeof(Slot);
-        auto d = static_cast<decltype(s)>(std::distance(first, ptr));
-        auto i = d / s;
+    void free(Handle handle) {
+        auto slot = getSlot(handle);
+        if (slot) {
+            release((uint16_t)std::distance(std::begin(objects), slot));
+        }
+    };
 
-        if (i >= 0 && i < size && (objects[i].check & 0x1) != 0) {
-            objects[i].check += 1;
+    /// @brief queue an object to be freed by the next flush(), safe to call while iterating the pool
+    /// @return true if the object was live and not already queued
+    bool deferFree(T* obj) {
+        int i = indexOf(obj);
+        if (i < 0) {
+            return false;
         }
+        return enqueue((uint16_t)i);
     };
 
-    void free(Handle handle) {
+    bool deferFree(Handle handle) {
         auto slot = getSlot(handle);
-        if (slot) {
-            slot->check += 1;
+        if (!slot) {
+            return false;
         }
+        return enqueue((uint16_t)std::distance(std::begin(objects), slot));
     };
 
+    bool isPendingFree(const T* obj) const {
+        int i = indexOf(obj);
+        return i >= 0 && (pendingBits[i / 8] & (1 << (i % 8))) != 0;
+    }
+
+    void flush() {
+        // Cleared first so that release() does not look for these in the queue
+        std::fill(std::begin(pendingBits), std::end(pendingBits), 0);
+        for (uint16_t i = 0; i < pendingCount; i++) {
+            free(pending[i]);
+        }
+        pendingCount = 0;
+    }
+
     T* get(Handle handle) {
         auto slot = getSlot(handle);
         if (slot) {
@@ -120,4 +216,64 @@ struct ObjectPool {
         }
         return nullptr;
     };
+
+  private:
+    int indexOf(const T* obj) const {
+        const char* ptr = reinterpret_cast<const char*>(obj);
+        const char* first = reinterpret_cast<const char*>(&std::begin(objects)->object);
+
+        if (ptr < first) {
+            return -1;
+        }
+
+        auto s = sizeof(Slot);
+        auto d = static_cast<decltype(s)>(std::distance(first, ptr));
+        auto i = d / s;
+
+        if (i < size && (objects[i].check & 0x1) != 0) {
+            return (int)i;
+        }
+        return -1;
+    }
+
+    bool enqueue(uint16_t index) {
+        uint8_t bit = (uint8_t)(1 << (index % 8));
+        if (pendingBits[index / 8] & bit) {
+            return false;
+        }
+        pendingBits[index / 8] |= bit;
+        pending[pendingCount++] = (Handle)(objects[index].check << 16 | index);
+        return true;
+    }
+
+    // A queued object that is freed right away leaves the queue, otherwise its
+    // bit would keep the next object in the slot from being queued
+    void dequeue(uint16_t index) {
+        uint8_t bit = (uint8_t)(1 << (index % 8));
+        if ((pendingBits[index / 8] & bit) == 0) {
+            return;
+        }
+        pendingBits[index / 8] &= (uint8_t)~bit;
+        for (uint16_t i = 0; i < pendingCount; i++) {
+            if ((uint16_t)pending[i] == index) {
+                pending[i] = pending[--pendingCount];
+                break;
+            }
+        }
+    }
+
+    void release(uint16_t index) {
+        dequeue(index);
+        objects[index].check = (uint16_t)(objects[index].check + 1);
+        freeIndices[freeCount++] = index;
+
+        liveCount--;
+        if constexpr (packed) {
+            uint16_t last = live[liveCount];
+            uint16_t position = livePosition[index];
+            live[position] = last;
+            livePosition[last] = position;
+        }
+        stats.onFree(liveCount);
+    }
 };
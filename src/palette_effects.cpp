@@ -0,0 +1,47 @@
+#include "palette_effects.hpp"
+
+namespace {
+
+uint32_t blend(uint32_t from, uint32_t to, int weight) {
+    uint32_t out = 0;
+    for (int shift = 0; shift < 24; shift += 8) {
+        const int a = (int)(from >> shift) & 0xff;
+        const int b = (int)(to >> shift) & 0xff;
+        out |= (uint32_t)(a + (b - a) * weight / PaletteEffects::opaque) << shift;
+    }
+    return out;
+}
+
+} // namespace
+
+bool PaletteEffects::update(uint32_t palette[4]) {
+    uint8_t weights[effectCount];
+    bool changed = false;
+    frame++;
+    for (int e = 0; e < effectCount; e++) {
+        const Description& description = descriptions[e];
+        uint8_t& s = step[e];
+        weights[e] = s == idle ? 0 : (uint8_t)weight((Effect)e, s);
+        if (s != idle && frame % description.framesPerStep == 0 && ++s == steps) {
+            s = description.hold ? (uint8_t)(steps - 1) : idle;
+        }
+        changed |= weights[e] != applied[e];
+    }
+    if (!changed || !base) {
+        return false;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        uint32_t color = base[i];
+        for (int e = 0; e < effectCount; e++) {
+            if (weights[e] != 0) {
+                color = blend(color, descriptions[e].color, weights[e]);
+            }
+        }
+        palette[i] = color;
+    }
+    for (int e = 0; e < effectCount; e++) {
+        applied[e] = weights[e];
+    }
+    return true;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+// Full screen effects played on the palette. Every effect blends the base
+// palette towards its own colour by a weight read from a ramp that is built at
+// compile time, a step every few frames. Effects playing at the same time are
+// applied in the order they are declared, and the palette is only composed
+// again when one of the weights changes.
+class PaletteEffects {
+  public:
+    enum Effect : uint8_t {
+        Flash,
+        DamageBlink,
+        // Holds black on its last step until stopped
+        FadeToBlack,
+        effectCount
+    };
+
+    static constexpr int steps = 16;
+    // Weights are 4 bits, packed two steps to a byte, and 15 replaces the colour entirely
+    static constexpr int opaque = 15;
+
+    using Ramp = std::array<uint8_t, steps / 2>;
+
+    struct Description {
+        uint32_t color;
+        uint8_t framesPerStep;
+        bool hold;
+    };
+
+    static constexpr Description descriptions[effectCount] = {
+        {0xffffff, 1, false},
+        {0xff0000, 2, false},
+        {0x000000, 2, true},
+    };
+
+    static constexpr std::array<Ramp, effectCount> ramps = [] {
+        int weights[effectCount][steps] = {};
+        for (int i = 0; i < steps; i++) {
+            // A fifth of the way to white, gone after 5 frames
+            weights[Flash][i] = i < 6 ? 3 * (6 - i) / 6 : 0;
+            // Half way to red, on and off every 4 frames
+            weights[DamageBlink][i] = i / 2 % 2 == 0 ? 8 : 0;
+            weights[FadeToBlack][i] = opaque * i / (steps - 1);
+        }
+
+        std::array<Ramp, effectCount> ramps{};
+        for (size_t e = 0; e < effectCount; e++) {
+            for (size_t i = 0; i < steps; i++) {
+                ramps[e][i / 2] |= (uint8_t)(weights[e][i] << (i % 2 * 4));
+            }
+        }
+        return ramps;
+    }();
+
+    static constexpr int weight(Effect effect, int step) {
+        return ramps[effect][(size_t)step / 2] >> (step % 2 * 4) & 0xf;
+    }
+
+    /// @brief blend from `palette`, which has to stay alive while effects play
+    void setBase(const uint32_t* palette) {
+        base = palette;
+        applied[0] = 0xff;
+    }
+
+    /// @brief start `effect` from its first step, restarting it if it is playing
+    void play(Effect effect) {
+        step[effect] = 0;
+    }
+
+    void stop(Effect effect) {
+        step[effect] = idle;
+    }
+
+    bool playing(Effect effect) const {
+        return step[effect] != idle;
+    }
+
+    /// @brief advance every playing effect by a frame and compose the palette into `palette`
+    /// @return false, leaving `palette` alone, if it would not change since the last call
+    bool update(uint32_t palette[4]);
+
+  private:
+    static constexpr uint8_t idle = 0xff;
+
+    const uint32_t* base = nullptr;
+    uint8_t step[effectCount] = {idle, idle, idle};
+    // Weights the last palette was composed with
+    uint8_t applied[effectCount] = {};
+    uint8_t frame = 0;
+};
@@ -0,0 +1,293 @@
+#include "physics.hpp"
+
+#include "wasm4.h"
+
+namespace {
+
+// Keeps bodies from catching on the edges of neighbouring tiles
+const Scalar padding = 1.5f;
+
+// Largest per-frame movement that still counts as standing still
+const Scalar restThreshold = 1 / 16.0f;
+
+Scalar abs(Scalar value) {
+    return value < 0 ? -value : value;
+}
+
+Scalar clamp(Scalar value, Scalar limit) {
+    return value < -limit ? -limit : (value > limit ? limit : value);
+}
+
+void respondY(Physics::Body& body, const Rect& rect) {
+    Rect e = body.bounds;
+    e.origin.x += padding;
+    e.size.width -= padding * 2;
+    e.origin.y += body.velocity.y;
+    if (e.collision(rect)) {
+        if (body.velocity.y > 0) {
+            body.velocity.y = 0;
+            body.bounds.origin.y = rect.origin.y - e.size.height;
+            body.flags |= Physics::ContactDown;
+        } else if (body.velocity.y < 0) {
+            body.velocity.y = 0;
+            body.bounds.origin.y = rect.origin.y + rect.size.height;
+            body.flags |= Physics::ContactUp;
+        }
+    }
+}
+
+void respondX(Physics::Body& body, const Rect& rect) {
+    Rect e = body.bounds;
+    e.origin.y += padding;
+    e.size.height -= padding * 2;
+    e.origin.x += body.velocity.x;
+
+    if (e.collision(rect)) {
+        if (body.velocity.x > 0) {
+            body.velocity.x = 0;
+            body.bounds.origin.x = rect.origin.x - e.size.width;
+            body.flags |= Physics::ContactRight;
+        } else if (body.velocity.x < 0) {
+            body.velocity.x = 0;
+            body.bounds.origin.x = rect.origin.x + rect.size.width;
+            body.flags |= Physics::ContactLeft;
+        }
+    }
+}
+
+} // namespace
+
+void Physics::update(World& world) {
+    gather(world);
+    integrate(world);
+    broadphase(world);
+    narrowphase(world);
+    response(world);
+    scatter();
+    findContacts();
+    sweepProjectiles(world);
+}
+
+void Physics::report() const {
+    tracef("physics: bodies %d, candidates %d/%d, dropped %d, contacts %d", (int)bodyCount, (int)candidateTotal,
+           (int)candidateCapacity, (int)droppedCandidates, (int)contactCount);
+}
+
+void Physics::gather(World& world) {
+    bodyCount = 0;
+    for (auto& entity : world.entities) {
+        if (bodyCount == capacity) {
+            break;
+        }
+        uint8_t flags = 0;
+        if (entity.asleep) {
+            flags |= Asleep;
+        }
+        if (entity.input.active()) {
+            flags |= Active;
+        }
+        owners[bodyCount] = &entity;
+        bodies[bodyCount++] = {entity.bounds, entity.velocity, flags, entity.team};
+    }
+}
+
+void Physics::integrate(World& world) {
+    const Rect& bounds = world.bounds;
+    for (size_t i = 0; i < bodyCount; i++) {
+        Body& body = bodies[i];
+        if (body.flags & Asleep) {
+            continue;
+        }
+        body.velocity.x = clamp(body.velocity.x, terminalSpeed);
+        body.velocity.y = clamp(body.velocity.y, terminalSpeed);
+        body.bounds.origin += body.velocity;
+
+        if (body.bounds.top() >= bounds.bottom()) {
+            body.bounds.origin.y -= bounds.height();
+        } else if (body.bounds.bottom() <= bounds.top()) {
+            body.bounds.origin.y += bounds.height();
+        }
+    }
+
+    auto& projectiles = world.projectiles;
+    Projectile::update(projectiles.field<Projectile::Position>(), projectiles.field<Projectile::PreviousPosition>(),
+                       projectiles.field<Projectile::Velocity>());
+}
+
+// Only the cells a body can reach this frame need to be tested
+Rect Physics::swept(const Body& body) {
+    const Vec2& v = body.velocity;
+    Rect rect = body.bounds;
+    rect.origin.x -= abs(v.x);
+    rect.origin.y -= abs(v.y);
+    rect.size.width += abs(v.x) * 2;
+    rect.size.height += abs(v.y) * 2;
+    return rect;
+}
+
+void Physics::broadphase(const World& world) {
+    candidateTotal = 0;
+    for (size_t i = 0; i < bodyCount; i++) {
+        firstCandidate[i] = (uint16_t)candidateTotal;
+        candidateCount[i] = 0;
+        if (bodies[i].flags & Asleep) {
+            continue;
+        }
+        world.grid.forEachSolid(swept(bodies[i]), [&](const Rect& collider) {
+            if (candidateCount[i] == maxCandidatesPerBody) {
+                droppedCandidates++;
+                return;
+            }
+            candidates[candidateTotal++] = (uint16_t)(&collider - world.grid.colliders);
+            candidateCount[i]++;
+        });
+    }
+}
+
+void Physics::narrowphase(const World& world) {
+    Rect nearby[maxCandidatesPerBody];
+    for (size_t i = 0; i < bodyCount; i++) {
+        uint16_t* first = candidates + firstCandidate[i];
+        const size_t count = candidateCount[i];
+        if (count == 0) {
+            continue;
+        }
+        for (size_t c = 0; c < count; c++) {
+            nearby[c] = world.grid.colliders[first[c]];
+        }
+        const uint32_t hits = math::collisionMask(swept(bodies[i]), nearby, count);
+
+        uint8_t kept = 0;
+        for (size_t c = 0; c < count; c++) {
+            if (hits & (1u << c)) {
+                first[kept++] = first[c];
+            }
+        }
+        candidateCount[i] = kept;
+    }
+}
+
+// Resolve vertically first so that bodies standing on a floor can still walk into walls
+void Physics::response(const World& world) {
+    for (size_t i = 0; i < bodyCount; i++) {
+        Body& body = bodies[i];
+        if (body.flags & Asleep) {
+            continue;
+        }
+        body.flags &= (uint8_t) ~(ContactUp | ContactDown | ContactLeft | ContactRight);
+
+        const uint16_t* first = candidates + firstCandidate[i];
+        for (size_t c = 0; c < candidateCount[i]; c++) {
+            respondY(body, world.grid.colliders[first[c]]);
+        }
+        for (size_t c = 0; c < candidateCount[i]; c++) {
+            respondX(body, world.grid.colliders[first[c]]);
+        }
+    }
+}
+
+void Physics::scatter() {
+    for (size_t i = 0; i < bodyCount; i++) {
+        Body& body = bodies[i];
+        Entity& entity = *owners[i];
+        if (body.flags & Asleep) {
+            continue;
+        }
+
+        const Vec2 moved = body.bounds.origin - entity.bounds.origin;
+        const bool still = abs(moved.x) < restThreshold && abs(moved.y) < restThreshold;
+        if (!(body.flags & Active) && still && (body.flags & ContactDown)) {
+            if (++entity.restFrames >= Entity::sleepAfter) {
+                entity.asleep = true;
+                body.flags |= Asleep;
+                body.velocity = {0, 0};
+            }
+        } else {
+            entity.restFrames = 0;
+        }
+
+        entity.bounds = body.bounds;
+        entity.velocity = body.velocity;
+        entity.collisions = {(body.flags & ContactUp) != 0, (body.flags & ContactDown) != 0,
+                             (body.flags & ContactLeft) != 0, (body.flags & ContactRight) != 0};
+    }
+}
+
+void Physics::findContacts() {
+    hash.clear();
+    for (size_t i = 0; i < bodyCount; i++) {
+        hash.insert(&bodies[i], bodies[i].bounds);
+    }
+
+    // Bodies near the current one are collected from the hash and tested a batch at a time
+    Rect nearby[maxBatch];
+    uint16_t others[maxBatch];
+    size_t count = 0;
+
+    contactCount = 0;
+    for (size_t i = 0; i < bodyCount && contactCount < contactCapacity; i++) {
+        const Body& body = bodies[i];
+        auto test = [&] {
+            const uint32_t hits = math::collisionMask(body.bounds, nearby, count);
+            for (size_t c = 0; c < count && contactCount < contactCapacity; c++) {
+                if (hits & (1u << c)) {
+                    contactList[contactCount++] = {owners[i], owners[others[c]]};
+                }
+            }
+            count = 0;
+        };
+
+        hash.query(body.bounds, [&](Body& other) {
+            // Every pair is visited from both sides, keep the one from the lower index
+            if (&other <= &body || other.team == body.team) {
+                return true;
+            }
+            nearby[count] = other.bounds;
+            others[count++] = (uint16_t)(&other - bodies);
+            if (count == maxBatch) {
+                test();
+            }
+            return contactCount < contactCapacity;
+        });
+        test();
+    }
+}
+
+void Physics::sweepProjectiles(World& world) {
+    const auto& projectiles = world.projectiles;
+    const auto positions = projectiles.field<Projectile::Position>();
+    const auto previousPositions = projectiles.field<Projectile::PreviousPosition>();
+    const auto teams = projectiles.field<Projectile::Team>();
+
+    hitCount = 0;
+    for (size_t i = 0; i < projectiles.count(); i++) {
+        const Vec2 from = previousPositions[i];
+        const Vec2 to = positions[i];
+        const int team = teams[i];
+
+        // Sweep the segment travelled this frame so fast shots cannot skip thin tiles
+        Scalar hit = 2;
+        world.grid.raycast(from, to, [&](const Rect& collider) {
+            Scalar t;
+            if (collider.raycast(from, to, t)) {
+                hit = t;
+                return false;
+            }
+            return true;
+        });
+
+        Entity* target = nullptr;
+        hash.query(Projectile::bounds(from, to), [&](Body& body) {
+            Scalar t;
+            if (body.team != team && body.bounds.raycast(from, to, t) && t < hit) {
+                hit = t;
+                target = owners[&body - bodies];
+            }
+            return true;
+        });
+
+        if (target || hit <= 1 || !world.bounds.contains(to)) {
+            hitList[hitCount++] = {i, target};
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "entity.hpp"
+#include "math.hpp"
+#include "spatial_hash.hpp"
+#include "world.hpp"
+
+#include <span>
+#include <stddef.h>
+#include <stdint.h>
+
+// Moves and collides everything in the World once per frame. Entities are
+// copied into a contiguous array of bodies, every stage runs as one batch over
+// that array and the results are written back to the entities at the end:
+//
+//   gather -> integrate -> broadphase -> narrowphase -> response -> scatter -> contacts
+//
+// Game code sets velocities before update() and reads collisions, contacts()
+// and projectileHits() after it.
+class Physics {
+  public:
+    static constexpr size_t capacity = decltype(World::entities)::capacity;
+    static constexpr size_t projectileCapacity = decltype(World::projectiles)::capacity;
+
+    enum Flags : uint8_t {
+        Asleep = 1 << 0,
+        // Driven by input this frame, so it may not fall asleep
+        Active = 1 << 1,
+        ContactUp = 1 << 2,
+        ContactDown = 1 << 3,
+        ContactLeft = 1 << 4,
+        ContactRight = 1 << 5,
+    };
+
+    struct Body {
+        Rect bounds;
+        Vec2 velocity;
+        uint8_t flags;
+        int team;
+    };
+
+    // Overlapping bodies of different teams
+    struct Contact {
+        Entity* a;
+        Entity* b;
+    };
+
+    // A projectile that hit a tile or an entity, or left the world
+    struct ProjectileHit {
+        size_t projectile;
+        Entity* target;
+    };
+
+    // Bodies are at most a tile in size, and integrate() keeps them under a
+    // tile per frame, which also stops them from tunnelling through floors
+    static constexpr int maxBodySize = World::Grid::tileSize;
+    static constexpr int terminalSpeed = World::Grid::tileSize - 1;
+
+    void update(World& world);
+
+    void report() const;
+
+    std::span<const Contact> contacts() const {
+        return {contactList, contactCount};
+    }
+
+    std::span<const ProjectileHit> projectileHits() const {
+        return {hitList, hitCount};
+    }
+
+  private:
+    // Rects math::collisionMask() tests in one call
+    static constexpr size_t maxBatch = 32;
+    // Tile colliders gathered per body by the broadphase, tested in one batch. A
+    // swept body spans at most this many cells on each axis, edges included,
+    // and each cell belongs to one collider
+    static constexpr int maxCellsPerAxis = (maxBodySize + 2 * terminalSpeed) / World::Grid::tileSize + 2;
+    static constexpr size_t maxCandidatesPerBody = (size_t)(maxCellsPerAxis * maxCellsPerAxis);
+    static_assert(maxCandidatesPerBody <= maxBatch, "a body's candidates must fit one collisionMask() call");
+    // Every body can take its full share, so one body never starves the next
+    static constexpr size_t candidateCapacity = capacity * maxCandidatesPerBody;
+    static constexpr size_t contactCapacity = 32;
+
+    void gather(World& world);
+    void integrate(World& world);
+    void broadphase(const World& world);
+    void narrowphase(const World& world);
+    void response(const World& world);
+    void scatter();
+    void findContacts();
+    void sweepProjectiles(World& world);
+
+    static Rect swept(const Body& body);
+
+    Body bodies[capacity];
+    Entity* owners[capacity];
+    size_t bodyCount;
+
+    // Collider indices into the grid, [first, first + count) per body. The
+    // broadphase fills them and the narrowphase drops the ones that miss
+    uint16_t candidates[candidateCapacity];
+    uint16_t firstCandidate[capacity];
+    uint8_t candidateCount[capacity];
+    size_t candidateTotal;
+    // Colliders left out because a body was larger than maxBodySize
+    uint32_t droppedCandidates;
+
+    SpatialHash<Body, capacity, SCREEN_SIZE, SCREEN_SIZE> hash;
+
+    Contact contactList[contactCapacity];
+    size_t contactCount;
+
+    ProjectileHit hitList[projectileCapacity];
+    size_t hitCount;
+};
@@ -0,0 +1,20 @@
+#include "pool_stats.hpp"
+
+#include "wasm4.h"
+
+void PoolStats::endFrame() {
+    if (frameAllocs > peakFrameAllocs) {
+        peakFrameAllocs = frameAllocs;
+    }
+    if (frameFrees > peakFrameFrees) {
+        peakFrameFrees = frameFrees;
+    }
+    frameAllocs = 0;
+    frameFrees = 0;
+}
+
+void PoolStats::report(const char* name, size_t capacity) const {
+    const double averageScan = scans > 0 ? (double)scanned / (double)scans : 0.0;
+    tracef("%s: live %d/%d, high %d, failed %d, peak allocs/frame %d, peak frees/frame %d, scan %f", name, (int)live,
+           (int)capacity, (int)highWater, (int)allocFailures, (int)peakFrameAllocs, (int)peakFrameFrees, averageScan);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Occupancy and allocation counters kept by every pool. The pools in the
+// global World sit at fixed addresses, so these can be read straight from
+// memory as well as printed with report().
+struct PoolStats {
+    uint16_t live;
+    uint16_t highWater;
+    uint16_t frameAllocs;
+    uint16_t frameFrees;
+    uint16_t peakFrameAllocs;
+    uint16_t peakFrameFrees;
+    uint32_t allocFailures;
+    // Slots visited by range-for loops, and the number of loops
+    uint32_t scanned;
+    uint32_t scans;
+
+    void onAlloc(uint16_t liveCount) {
+        live = liveCount;
+        if (live > highWater) {
+            highWater = live;
+        }
+        frameAllocs++;
+    }
+
+    void onFree(uint16_t liveCount) {
+        live = liveCount;
+        frameFrees++;
+    }
+
+    void onAllocFailure() {
+        allocFailures++;
+    }
+
+    void onScan(uint16_t length) {
+        scanned += length;
+        scans++;
+    }
+
+    void endFrame();
+    void report(const char* name, size_t capacity) const;
+};
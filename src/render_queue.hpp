@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <stddef.h>
+#include <stdint.h>
+
+// One recorded draw, in screen space. What `a` and `b` hold depends on the type.
+struct RenderCommand {
+    enum Type : uint8_t {
+        // a: sprite frame, b: blit flags
+        Sprite,
+        // a, b: width and height
+        Fill,
+        // a, b: end point, as int16_t
+        Line,
+        // a: offset of the null terminated text in the queue, b: length
+        Text
+    };
+
+    // Layer in the high nibble and order within it in the low one
+    uint8_t key;
+    Type type;
+    uint16_t colors;
+    int16_t x;
+    int16_t y;
+    uint16_t a;
+    uint16_t b;
+};
+
+// Draws recorded during a frame. Commands outside the screen are dropped as
+// they are pushed, and drain() hands the rest over sorted by key with a radix
+// sort, stable so that equal keys keep the order they were recorded in.
+template <size_t capacity, size_t textCapacity = 48>
+struct RenderQueue {
+    static_assert(capacity <= 256, "sorted order is kept in uint8_t indices");
+
+    struct Stats {
+        // Draw calls this frame and the most in any frame
+        uint16_t commands;
+        uint16_t peakCommands;
+        uint32_t culled;
+        // Drains forced by a full queue, which break the sort between the halves
+        uint32_t overflows;
+    };
+
+    RenderCommand commands[capacity];
+    uint16_t count;
+    char text[textCapacity];
+    uint16_t textUsed;
+
+    Stats stats;
+
+    bool full() const {
+        return count == capacity;
+    }
+
+    bool hasText(size_t length) const {
+        return textUsed + length + 1 <= textCapacity;
+    }
+
+    /// @brief record `command` unless [left, right) x [top, bottom) misses the screen
+    /// @return false if it was culled
+    bool push(const RenderCommand& command, int left, int top, int right, int bottom, int screenSize) {
+        if (right <= 0 || bottom <= 0 || left >= screenSize || top >= screenSize) {
+            stats.culled++;
+            return false;
+        }
+        commands[count++] = command;
+        stats.commands++;
+        return true;
+    }
+
+    /// @brief copy text into the queue, call hasText() first
+    /// @return offset to store in a Text command
+    uint16_t pushText(const char* value, size_t length) {
+        const uint16_t offset = textUsed;
+        std::copy(value, value + length, text + offset);
+        text[offset + length] = '\0';
+        textUsed = (uint16_t)(textUsed + length + 1);
+        return offset;
+    }
+
+    /// @brief call `fn(const RenderCommand&)` for every command, sorted by key, and empty the queue
+    template <typename Fn>
+    void drain(Fn&& fn) {
+        uint8_t order[capacity];
+        uint8_t sorted[capacity];
+        for (uint16_t i = 0; i < count; i++) {
+            order[i] = (uint8_t)i;
+        }
+        // Least significant nibble first
+        for (int shift = 0; shift < 8; shift += 4) {
+            uint16_t starts[16] = {};
+            for (uint16_t i = 0; i < count; i++) {
+                starts[(commands[order[i]].key >> shift) & 0xf]++;
+            }
+            uint16_t start = 0;
+            for (auto& bucket : starts) {
+                const uint16_t size = bucket;
+                bucket = start;
+                start = (uint16_t)(start + size);
+            }
+            for (uint16_t i = 0; i < count; i++) {
+                sorted[starts[(commands[order[i]].key >> shift) & 0xf]++] = order[i];
+            }
+            std::copy(sorted, sorted + count, order);
+        }
+
+        for (uint16_t i = 0; i < count; i++) {
+            fn(commands[order[i]]);
+        }
+        count = 0;
+        textUsed = 0;
+    }
+
+    void endFrame() {
+        if (stats.commands > stats.peakCommands) {
+            stats.peakCommands = stats.commands;
+        }
+        stats.commands = 0;
+    }
+};
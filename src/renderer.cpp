@@ -1,6 +1,7 @@
 #include "renderer.hpp"
 #include "assets.hpp"
 #include <algorithm>
+#include <string.h>
 
 #include "wasm4.h"
 
@@ -21,48 +22,217 @@ void Renderer::clear(uint8_t color) {
     std::fill(FRAMEBUFFER, FRAMEBUFFER + SCREEN_SIZE * SCREEN_SIZE / 4, i | (i << 2) | (i << 4) | (i << 6));
 }
 
+void Renderer::clear(uint8_t color, int x, int y, int width, int height) {
+    uint8_t i = color - 1;
+    const uint8_t value = i | (i << 2) | (i << 4) | (i << 6);
+    for (int row = y; row < y + height; row++) {
+        uint8_t* start = FRAMEBUFFER + (row * SCREEN_SIZE + x) / 4;
+        std::fill(start, start + width / 4, value);
+    }
+}
+
+void Renderer::beginFrame(uint8_t color) {
+#if DIRTY_RECT_RENDERING
+    dirty.forEachRun([&](int x, int y, int width, int height) { clear(color, x, y, width, height); });
+#else
+    clear(color);
+#endif
+}
+
+void Renderer::endFrame() {
+    flush();
+    queue.endFrame();
+#if DIRTY_RECT_RENDERING
+    dirty = moving;
+    moving.reset();
+#endif
+}
+
+void Renderer::invalidate() {
+#if DIRTY_RECT_RENDERING
+    dirty.markAll();
+#endif
+}
+
+void Renderer::invalidate(const Rect& r) {
+#if DIRTY_RECT_RENDERING
+    dirty.mark(toScreen(r));
+#endif
+}
+
+void Renderer::invalidateMoving(const Rect& r) {
+#if DIRTY_RECT_RENDERING
+    const Rect screen = toScreen(r);
+    dirty.mark(screen);
+    moving.mark(screen);
+#endif
+}
+
+bool Renderer::include(const Rect& r) {
+#if DIRTY_RECT_RENDERING
+    const Rect screen = toScreen(r);
+    if (dirty.touches(screen) && !dirty.covers(screen)) {
+        dirty.mark(screen);
+        return true;
+    }
+#endif
+    return false;
+}
+
+bool Renderer::needsDraw(const Rect& r) const {
+#if DIRTY_RECT_RENDERING
+    return dirty.covers(toScreen(r));
+#else
+    return true;
+#endif
+}
+
+void Renderer::setLayer(Layer layer, uint8_t order) {
+    key = (uint8_t)((uint8_t)layer << 4 | (order & 0xf));
+}
+
 void Renderer::useColor(const uint16_t i) {
-    *DRAW_COLORS = i;
+    colors = i;
 }
 
 void Renderer::draw(const Vec2& v) {
-    rect((int)(v.x + cameraPosition.x), (int)(v.y + cameraPosition.y), 1, 1);
+    const int x = (int)(v.x + cameraPosition.x);
+    const int y = (int)(v.y + cameraPosition.y);
+    push({key, RenderCommand::Fill, colors, (int16_t)x, (int16_t)y, 1, 1}, x, y, x + 1, y + 1);
 }
 
 void Renderer::draw(const Vec2& p0, const Vec2& p1) {
-    line((int)(p0.x + cameraPosition.x), (int)(p0.y + cameraPosition.y), (int)(p1.x + cameraPosition.x),
-         (int)(p1.y + cameraPosition.y));
+    const int x0 = (int)(p0.x + cameraPosition.x);
+    const int y0 = (int)(p0.y + cameraPosition.y);
+    const int x1 = (int)(p1.x + cameraPosition.x);
+    const int y1 = (int)(p1.y + cameraPosition.y);
+    push({key, RenderCommand::Line, colors, (int16_t)x0, (int16_t)y0, (uint16_t)(int16_t)x1, (uint16_t)(int16_t)y1},
+         std::min(x0, x1), std::min(y0, y1), std::max(x0, x1) + 1, std::max(y0, y1) + 1);
 }
 
 void Renderer::draw(const Rect& r) {
-    rect((int)(r.origin.x + cameraPosition.x), (int)(r.origin.y + cameraPosition.y), (uint32_t)r.size.width,
-         (uint32_t)r.size.height);
+    const int x = (int)(r.origin.x + cameraPosition.x);
+    const int y = (int)(r.origin.y + cameraPosition.y);
+    const int width = (int)r.size.width;
+    const int height = (int)r.size.height;
+    push({key, RenderCommand::Fill, colors, (int16_t)x, (int16_t)y, (uint16_t)width, (uint16_t)height}, x, y,
+         x + width, y + height);
 }
 
-void Renderer::drawSpriteFrame(int index, int x, int y, bool flipX, bool flipY, BitsPerPixel bbp) {
-    const uint32_t flags = ((uint32_t)bbp) | (flipX ? BLIT_FLIP_X : 0) | (flipY ? BLIT_FLIP_Y : 0);
-    const uint32_t srcW = 16;
-    const uint32_t srcH = 16;
-    const uint32_t stride = assets::tilemapWidth;
-    const uint32_t srcX = ((uint32_t)index % 20) * srcW;
-    const uint32_t srcY = ((uint32_t)index / 20) * srcH;
+void Renderer::drawSpriteFrame(int id, int x, int y, bool flipX, bool flipY) {
+    const int index = storedFrame(id);
+    const bool oneBit = isOneBitFrame(index);
+    const BitsPerPixel bbp = oneBit ? BitsPerPixel::One : BitsPerPixel::Two;
+    const uint32_t flips = ((flipX ? BLIT_FLIP_X : 0) | (flipY ? BLIT_FLIP_Y : 0)) ^ frameFlips(id);
+    const uint32_t flags = ((uint32_t)bbp) | flips;
+    const uint16_t frameColors = oneBit ? oneBitColors(index, colors) : colors;
+    x += (int)(cameraPosition.x);
+    y += (int)(cameraPosition.y);
+    push({key, RenderCommand::Sprite, frameColors, (int16_t)x, (int16_t)y, (uint16_t)index, (uint16_t)flags}, x, y,
+         x + 16, y + 16);
+}
 
-    blitSub(assets::tilemap, x + (int)(cameraPosition.x), y + (int)(cameraPosition.y), srcW, srcH, srcX, srcY, stride,
-            flags);
+void Renderer::drawLayer(const uint8_t* pixels, int width, int height, const Vec2& origin) {
+    // Queued draws set their own colors when they are issued
+    *DRAW_COLORS = 0x4321;
+
+    const int x = (int)origin.x + (int)cameraPosition.x;
+    const int y = (int)origin.y + (int)cameraPosition.y;
+#if DIRTY_RECT_RENDERING
+    dirty.forEachRun([&](int runX, int runY, int runWidth, int runHeight) {
+        const int x0 = std::max(runX, x);
+        const int y0 = std::max(runY, y);
+        const int x1 = std::min(runX + runWidth, x + width);
+        const int y1 = std::min(runY + runHeight, y + height);
+        if (x0 < x1 && y0 < y1) {
+            blitSub(pixels, x0, y0, (uint32_t)(x1 - x0), (uint32_t)(y1 - y0), (uint32_t)(x0 - x), (uint32_t)(y0 - y),
+                    (uint32_t)width, BLIT_2BPP);
+        }
+    });
+#else
+    blitSub(pixels, x, y, (uint32_t)width, (uint32_t)height, 0, 0, (uint32_t)width, BLIT_2BPP);
+#endif
 }
 
 void Renderer::drawText(const char* text, int x, int y) {
-    ::text(text, x + (int)(cameraPosition.x), y + (int)(cameraPosition.y));
+    drawText({text, strlen(text)}, x, y);
 }
 
-void Renderer::drawText(std::span<char> text, int x, int y) {
-    if (text.end() != std::find(text.begin(), text.end(), '\0')) {
-        drawText(text.data(), x, y);
-    } else {
-        char tmp[2] = " ";
-        for (int i = 0; i < (int)text.size(); i++) {
-            tmp[0] = text[(size_t)i];
-            drawText(tmp, x + i * 8, y);
+void Renderer::drawText(std::span<const char> text, int x, int y) {
+    const size_t length = (size_t)(std::find(text.begin(), text.end(), '\0') - text.begin());
+    x += (int)(cameraPosition.x);
+    y += (int)(cameraPosition.y);
+    if (!queue.hasText(length) || queue.full()) {
+        flush();
+        queue.stats.overflows++;
+        // Longer than the whole text buffer
+        if (!queue.hasText(length)) {
+            return;
         }
     }
+
+    const uint16_t offset = queue.pushText(text.data(), length);
+    if (!push({key, RenderCommand::Text, colors, (int16_t)x, (int16_t)y, offset, (uint16_t)length}, x, y,
+              x + (int)length * 8, y + 8)) {
+        queue.textUsed = offset;
+    }
+}
+
+void Renderer::report() const {
+    tracef("renderer: queued %d, peak draws/frame %d, culled %d, overflows %d, software blits %d, blitSub %d, "
+           "frames decoded %d, reused %d",
+           (int)queue.count, (int)queue.stats.peakCommands, (int)queue.stats.culled, (int)queue.stats.overflows,
+           (int)softwareBlits, (int)hostBlits, (int)frames.stats.misses, (int)frames.stats.hits);
+}
+
+bool Renderer::push(const RenderCommand& command, int left, int top, int right, int bottom) {
+    if (queue.full()) {
+        flush();
+        queue.stats.overflows++;
+    }
+    return queue.push(command, left, top, right, bottom, SCREEN_SIZE);
+}
+
+void Renderer::flush() {
+    uint32_t issuedColors = 0x10000;
+    queue.drain([&](const RenderCommand& command) {
+        if (command.colors != issuedColors) {
+            *DRAW_COLORS = command.colors;
+            issuedColors = command.colors;
+        }
+
+        switch (command.type) {
+        case RenderCommand::Sprite: {
+            const uint8_t* pixels = frames.get(command.a);
+#if SOFTWARE_BLIT
+            // Skips the host call, clipped sprites are left to blitSub
+            if (blitter::canDraw(command.x, command.b)) {
+                blitter::drawSprite(FRAMEBUFFER, pixels, command.a, command.x, command.y, command.b, command.colors,
+                                    spriteCache);
+                softwareBlits++;
+                break;
+            }
+#endif
+            blitSub(pixels, command.x, command.y, 16, 16, 0, 0, 16, command.b);
+            hostBlits++;
+            break;
+        }
+        case RenderCommand::Fill:
+            rect(command.x, command.y, command.a, command.b);
+            break;
+        case RenderCommand::Line:
+            line(command.x, command.y, (int16_t)command.a, (int16_t)command.b);
+            break;
+        case RenderCommand::Text:
+#if SOFTWARE_BLIT
+            // Digits come from the small font in assets, anything else from the host font
+            if (blitter::drawText(FRAMEBUFFER, assets::font, assets::fontFirst, assets::fontGlyphs,
+                                  queue.text + command.a, command.b, command.x, command.y, command.colors)) {
+                break;
+            }
+#endif
+            ::text(queue.text + command.a, command.x, command.y);
+            break;
+        }
+    });
 }
@@ -4,9 +4,16 @@
 #include "wasm4.h"
 
 #include "assets.hpp"
+#include "blitter.hpp"
+#include "dirty_region.hpp"
+#include "frame_cache.hpp"
+#include "render_queue.hpp"
 
 #include <span>
 
+// Draw calls are recorded into a RenderQueue and issued to the host sorted by
+// layer when the frame ends, skipping anything outside the screen. Clearing
+// and drawLayer() still happen immediately, underneath everything queued.
 class Renderer {
   public:
     enum class BitsPerPixel : uint32_t {
@@ -14,11 +21,20 @@ class Renderer {
         Two = BLIT_2BPP
     };
 
+    // Back to front
+    enum class Layer : uint8_t {
+        Tiles,
+        Projectiles,
+        Entities,
+        Hud,
+        Debug
+    };
+
     /// @brief set the viewport to {x, y}, {x + SCREEN_SIZE, y + SCREEN_SIZE}
     /// @param x
     /// @param y
     void setViewport(int x, int y);
-    void setViewport(float x, float y) {
+    void setViewport(Scalar x, Scalar y) {
         setViewport(static_cast<int>(x), static_cast<int>(y));
     };
 
@@ -28,20 +44,76 @@ class Renderer {
     };
 
     void clear(uint8_t color);
+    /// @brief fill part of the framebuffer, `x` and `width` must be multiples of 4
+    void clear(uint8_t color, int x, int y, int width, int height);
+
+    /// @brief clear what is about to be redrawn: the dirty cells, or the whole screen
+    void beginFrame(uint8_t color);
+    /// @brief issue the queued draws
+    void endFrame();
+
+    // Dirty-rect rendering (DIRTY_RECT_RENDERING=1). Rects are in world space
+    // and go through the viewport like everything drawn; without it every
+    // frame is a full redraw and these do nothing.
+    void invalidate();
+    void invalidate(const Rect& r);
+    /// @brief invalidate `r` now and again next frame, to erase it after it moves
+    void invalidateMoving(const Rect& r);
+    /// @brief mark all of `r` dirty if part of it is
+    /// @return whether the dirty area grew
+    bool include(const Rect& r);
+    bool needsDraw(const Rect& r) const;
+
+    /// @brief draw into `layer` from now on, `order` sorts draws within it
+    void setLayer(Layer layer, uint8_t order = 0);
     void useColor(const uint16_t i);
     void draw(const Vec2& v);
     void draw(const Vec2& p0, const Vec2& p1);
     void draw(const Rect& r);
-    void drawSpriteFrame(int index, int x, int y, bool flipX = false, bool flipY = false,
-                         BitsPerPixel bbp = BitsPerPixel::Two);
-    void drawSpriteFrame(assets::SpriteFrame frame, int x, int y, bool flipX = false, bool flipY = false,
-                         BitsPerPixel bbp = BitsPerPixel::Two) {
-        drawSpriteFrame((int)frame, x, y, flipX, flipY, bbp);
+    /// @brief draw a frame id from assets::atlasFrame() at the bit depth it is stored in, colored as the 2bpp original
+    void drawSpriteFrame(int id, int x, int y, bool flipX = false, bool flipY = false);
+    void drawSpriteFrame(assets::SpriteFrame frame, int x, int y, bool flipX = false, bool flipY = false) {
+        drawSpriteFrame((int)frame, x, y, flipX, flipY);
     };
 
+    /// @brief draw a 2bpp image of palette indices, such as a TileLayer, with its top left at `origin`
+    /// Only the dirty cells are drawn when dirty-rect rendering is on.
+    void drawLayer(const uint8_t* pixels, int width, int height, const Vec2& origin);
+
     void drawText(const char* text, int x, int y);
-    void drawText(std::span<char> text, int x, int y);
+    void drawText(std::span<const char> text, int x, int y);
+
+    /// @brief pre-shifted sprites for the software blitter (SOFTWARE_BLIT=1) to keep, may be empty
+    void useSpriteCache(std::span<blitter::Preshifted> cache) {
+        spriteCache = cache;
+    }
+
+    void report() const;
 
   private:
+    // Records a command covering [left, right) x [top, bottom) on screen, false if it was culled
+    bool push(const RenderCommand& command, int left, int top, int right, int bottom);
+    void flush();
+
     Vec2 cameraPosition = {0, 0};
+    uint16_t colors = 0x1203;
+    uint8_t key = 0;
+
+    RenderQueue<96> queue;
+    // Decoded sprite frames, enough for every sprite on screen in a typical frame
+    FrameCache<16> frames;
+
+    std::span<blitter::Preshifted> spriteCache;
+    uint32_t softwareBlits = 0;
+    uint32_t hostBlits = 0;
+
+#if DIRTY_RECT_RENDERING
+    Rect toScreen(const Rect& r) const {
+        return {r.origin + cameraPosition, r.size};
+    }
+
+    DirtyRegion<SCREEN_SIZE, SCREEN_SIZE> dirty;
+    // Cells covered by moving objects this frame, dirty again next frame
+    DirtyRegion<SCREEN_SIZE, SCREEN_SIZE> moving;
+#endif
 };
\ No newline at end of file
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <stddef.h>
+#include <stdint.h>
+#include <tuple>
+#include <utility>
+
+#include "pool_stats.hpp"
+
+// Structure-of-arrays counterpart to ObjectPool. Every field lives in its own
+// contiguous array, packed so that the live objects always occupy [0, count()).
+// Handles use the same check << 16 | id layout as ObjectPool; ids are stable
+// while the packed position of an object changes when others are freed.
+template <size_t size, typename... Fields>
+struct SoaPool {
+    using Handle = uint32_t;
+    const static Handle invalid_handle = 0;
+
+    static_assert(size <= 0xffff, "id must fit in the lower half of a handle");
+
+    static constexpr size_t capacity = size;
+
+    template <size_t I>
+    using Field = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    // Generation per id, odd while the id is alive.
+    uint16_t checks[size];
+    // Packed position -> id. Entries in [count, used) are ids free for reuse.
+    uint16_t ids[size];
+    // Id -> packed position.
+    uint16_t positions[size];
+    uint16_t liveCount;
+    uint16_t used;
+
+    std::tuple<std::array<Fields, size>...> fields;
+
+    // Frees requested with deferFree(), applied in one batch by flush().
+    Handle pending[size];
+    uint16_t pendingCount;
+    uint8_t pendingBits[(size + 7) / 8];
+
+    PoolStats stats;
+
+    Handle alloc() {
+        if (liveCount == size) {
+            stats.onAllocFailure();
+            return invalid_handle;
+        }
+
+        if (liveCount == used) {
+            ids[liveCount] = used++;
+        }
+
+        uint16_t id = ids[liveCount];
+        positions[id] = liveCount;
+        liveCount++;
+        stats.onAlloc(liveCount);
+
+        uint16_t check = checks[id] = (uint16_t)(checks[id] + 1);
+        return (Handle)(check << 16 | id);
+    };
+
+    Handle create(Fields... values) {
+        auto handle = alloc();
+        if (handle) {
+            size_t position = liveCount - 1u;
+            [&]<size_t... I>(std::index_sequence<I...>) {
+                ((std::get<I>(fields)[position] = values), ...);
+            }(std::index_sequence_for<Fields...>{});
+        }
+        return handle;
+    };
+
+    // Packed position of the object behind `handle`, or -1 if it is stale.
+    int position(Handle handle) const {
+        uint16_t id = (uint16_t)handle;
+        uint16_t check = (uint16_t)(handle >> 16);
+
+        if ((check & 0x1) == 0 || id >= size || checks[id] != check) {
+            return -1;
+        }
+        return positions[id];
+    }
+
+    Handle handle(size_t position) const {
+        uint16_t id = ids[position];
+        return (Handle)(checks[id] << 16 | id);
+    }
+
+    template <size_t I>
+    Field<I>* get(Handle handle) {
+        int i = position(handle);
+        if (i < 0) {
+            return nullptr;
+        }
+        return &std::get<I>(fields)[(size_t)i];
+    };
+
+    // The live values of one field, in packed order.
+    template <size_t I>
+    std::span<Field<I>> field() {
+        return {std::get<I>(fields).data(), liveCount};
+    }
+
+    template <size_t I>
+    std::span<const Field<I>> field() const {
+        return {std::get<I>(fields).data(), liveCount};
+    }
+
+    size_t count() const {
+        return liveCount;
+    }
+
+    void free(Handle handle) {
+        int i = position(handle);
+        if (i >= 0) {
+            freeAt((size_t)i);
+        }
+    };
+
+    /// @brief queue the object at a packed position to be freed by the next flush()
+    /// Positions stay valid until then, so loops may walk the pool in any order.
+    /// @return true if the position is live and its object not already queued
+    bool deferFree(size_t position) {
+        if (position >= liveCount) {
+            return false;
+        }
+        uint16_t id = ids[position];
+        uint8_t bit = (uint8_t)(1 << (id % 8));
+        if (pendingBits[id / 8] & bit) {
+            return false;
+        }
+        pendingBits[id / 8] |= bit;
+        pending[pendingCount++] = handle(position);
+        return true;
+    }
+
+    void flush() {
+        // Cleared first so that freeAt() does not look for these in the queue
+        std::fill(std::begin(pendingBits), std::end(pendingBits), 0);
+        for (uint16_t i = 0; i < pendingCount; i++) {
+            free(pending[i]);
+        }
+        pendingCount = 0;
+    }
+
+    // Frees the object at a packed position by moving the last object into
+    // it. Loops that free while iterating should therefore walk backwards.
+    void freeAt(size_t position) {
+        uint16_t id = ids[position];
+        uint16_t last = (uint16_t)(liveCount - 1);
+
+        dequeue(id);
+        checks[id] = (uint16_t)(checks[id] + 1);
+
+        if (position != last) {
+            [&]<size_t... I>(std::index_sequence<I...>) {
+                ((std::get<I>(fields)[position] = std::get<I>(fields)[last]), ...);
+            }(std::index_sequence_for<Fields...>{});
+
+            uint16_t moved = ids[last];
+            ids[position] = moved;
+            positions[moved] = (uint16_t)position;
+        }
+
+        ids[last] = id;
+        liveCount = last;
+        stats.onFree(liveCount);
+    };
+
+  private:
+    // A queued object that is freed right away leaves the queue, otherwise its
+    // bit would keep the next object with the same id from being queued
+    void dequeue(uint16_t id) {
+        uint8_t bit = (uint8_t)(1 << (id % 8));
+        if ((pendingBits[id / 8] & bit) == 0) {
+            return;
+        }
+        pendingBits[id / 8] &= (uint8_t)~bit;
+        for (uint16_t i = 0; i < pendingCount; i++) {
+            if ((uint16_t)pending[i] == id) {
+                pending[i] = pending[--pendingCount];
+                break;
+            }
+        }
+    }
+};
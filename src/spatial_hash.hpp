@@ -0,0 +1,108 @@
+#pragma once
+
+#include "math.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stddef.h>
+#include <stdint.h>
+
+// Broadphase for moving objects, rebuilt every frame. The area is split into
+// square buckets; an object is linked into every bucket its bounds touch and
+// queries only visit the buckets around the query rect. Rows wrap around, to
+// match the vertical wrap applied to entities, and columns are clamped.
+template <typename T, size_t capacity, int width, int height, int cellSize = 32>
+struct SpatialHash {
+    static constexpr int columns = (width + cellSize - 1) / cellSize;
+    static constexpr int rows = (height + cellSize - 1) / cellSize;
+    static constexpr size_t bucketCount = (size_t)(columns * rows);
+    // Objects no larger than a bucket touch at most 4 of them
+    static constexpr size_t nodeCapacity = capacity * 4;
+
+    struct Node {
+        uint16_t item;
+        int16_t next;
+    };
+
+    T* items[capacity];
+    uint16_t stamps[capacity];
+    uint16_t stamp;
+    uint16_t itemCount;
+
+    int16_t heads[bucketCount];
+    Node nodes[nodeCapacity];
+    uint16_t nodeCount;
+
+    void clear() {
+        itemCount = 0;
+        nodeCount = 0;
+        std::fill(std::begin(heads), std::end(heads), -1);
+    }
+
+    void insert(T* item, const Rect& bounds) {
+        if (itemCount == capacity) {
+            return;
+        }
+        const uint16_t index = itemCount++;
+        items[index] = item;
+        stamps[index] = stamp;
+
+        forEachBucket(bounds, [&](int bucket) {
+            if (nodeCount == nodeCapacity) {
+                return;
+            }
+            nodes[nodeCount] = {index, heads[bucket]};
+            heads[bucket] = (int16_t)nodeCount;
+            nodeCount++;
+        });
+    }
+
+    /// @brief call `fn(T&)` once for every object in the buckets touched by `rect`
+    /// @param fn returns false to stop the query
+    template <typename Fn>
+    void query(const Rect& rect, Fn&& fn) {
+        if (++stamp == 0) {
+            std::fill(std::begin(stamps), std::end(stamps), 0);
+            stamp = 1;
+        }
+
+        bool done = false;
+        forEachBucket(rect, [&](int bucket) {
+            for (int16_t n = heads[bucket]; n >= 0 && !done; n = nodes[n].next) {
+                const uint16_t index = nodes[n].item;
+                if (stamps[index] == stamp) {
+                    continue;
+                }
+                stamps[index] = stamp;
+                done = !fn(*items[index]);
+            }
+        });
+    }
+
+    template <typename Fn>
+    void query(const Vec2& point, Fn&& fn) {
+        query(Rect{point, {0, 0}}, fn);
+    }
+
+  private:
+    static int cell(Scalar position) {
+        const Scalar c = position / cellSize;
+        const int i = (int)c;
+        return (c < 0 && (Scalar)i != c) ? i - 1 : i;
+    }
+
+    template <typename Fn>
+    static void forEachBucket(const Rect& rect, Fn&& fn) {
+        const int x0 = std::clamp(cell(rect.left()), 0, columns - 1);
+        const int x1 = std::clamp(cell(rect.right()), 0, columns - 1);
+        const int y0 = cell(rect.top());
+        const int y1 = std::min(cell(rect.bottom()), y0 + rows - 1);
+
+        for (int y = y0; y <= y1; y++) {
+            const int row = ((y % rows) + rows) % rows;
+            for (int x = x0; x <= x1; x++) {
+                fn(row * columns + x);
+            }
+        }
+    }
+};
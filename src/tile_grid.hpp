@@ -0,0 +1,199 @@
+#pragma once
+
+#include "math.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stddef.h>
+#include <stdint.h>
+
+// Uniform collision grid over the level. Each cell records the height of the
+// solid tile placed in it (aligned to the top of the cell). build() merges
+// runs of equal tiles into as few rects as it can, and queries only visit the
+// cells a rect or segment overlaps instead of every tile.
+template <int width, int height, int cellSize = 16>
+struct TileGrid {
+    static constexpr int columns = width;
+    static constexpr int rows = height;
+    static constexpr int tileSize = cellSize;
+    static constexpr size_t cellCount = (size_t)(width * height);
+    static constexpr uint16_t noCollider = 0xffff;
+
+    // Inclusive range of cells
+    struct Range {
+        int x0, y0, x1, y1;
+
+        bool empty() const {
+            return x0 > x1 || y0 > y1;
+        }
+    };
+
+    Vec2 origin = {0, 0};
+    // Solid height per cell in pixels, 0 when empty
+    uint8_t heights[cellCount];
+    // Merged collision rects, the collider each cell belongs to, and the
+    // first cell of every collider
+    Rect colliders[cellCount];
+    uint16_t colliderOf[cellCount];
+    uint8_t colliderX[cellCount];
+    uint8_t colliderY[cellCount];
+    uint16_t colliderCount;
+
+    void set(int x, int y, int tileHeight = cellSize) {
+        heights[y * width + x] = (uint8_t)tileHeight;
+    }
+
+    void clear(int x, int y) {
+        heights[y * width + x] = 0;
+    }
+
+    bool isSolid(int x, int y) const {
+        return heights[y * width + x] != 0;
+    }
+
+    /// @brief greedily merge solid cells into colliders; call after changing cells
+    /// Horizontal runs of equal height are merged first, and full height runs
+    /// then grow down over rows with the same span.
+    void build() {
+        colliderCount = 0;
+        std::fill(std::begin(colliderOf), std::end(colliderOf), noCollider);
+
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                const int i = y * width + x;
+                const uint8_t h = heights[i];
+                if (h == 0 || colliderOf[i] != noCollider) {
+                    continue;
+                }
+
+                int w = 1;
+                while (x + w < width && heights[i + w] == h && colliderOf[i + w] == noCollider) {
+                    w++;
+                }
+
+                int r = 1;
+                while (h == cellSize && y + r < height && isFreeRun(x, y + r, w)) {
+                    r++;
+                }
+
+                const uint16_t collider = colliderCount++;
+                colliders[collider] = {{origin.x + (Scalar)(x * cellSize), origin.y + (Scalar)(y * cellSize)},
+                                       {(Scalar)(w * cellSize), (Scalar)((r - 1) * cellSize + h)}};
+                colliderX[collider] = (uint8_t)x;
+                colliderY[collider] = (uint8_t)y;
+                for (int cy = y; cy < y + r; cy++) {
+                    for (int cx = x; cx < x + w; cx++) {
+                        colliderOf[cy * width + cx] = collider;
+                    }
+                }
+            }
+        }
+    }
+
+    /// @brief cells touched by `rect`, edges included, clamped to the grid
+    Range cellsOverlapping(const Rect& rect) const {
+        Range range = {cell(rect.left() - origin.x), cell(rect.top() - origin.y), cell(rect.right() - origin.x),
+                       cell(rect.bottom() - origin.y)};
+        range.x0 = range.x0 < 0 ? 0 : range.x0;
+        range.y0 = range.y0 < 0 ? 0 : range.y0;
+        range.x1 = range.x1 >= width ? width - 1 : range.x1;
+        range.y1 = range.y1 >= height ? height - 1 : range.y1;
+        return range;
+    }
+
+    /// @brief call `fn(const Rect&)` once for every collider touching the cells `rect` overlaps
+    template <typename Fn>
+    void forEachSolid(const Rect& rect, Fn&& fn) const {
+        const Range range = cellsOverlapping(rect);
+        for (int y = range.y0; y <= range.y1; y++) {
+            for (int x = range.x0; x <= range.x1; x++) {
+                const uint16_t collider = colliderOf[y * width + x];
+                if (collider == noCollider) {
+                    continue;
+                }
+                // Report a collider only from its first cell inside the range
+                const int firstX = colliderX[collider] > range.x0 ? colliderX[collider] : range.x0;
+                const int firstY = colliderY[collider] > range.y0 ? colliderY[collider] : range.y0;
+                if (x == firstX && y == firstY) {
+                    fn(colliders[collider]);
+                }
+            }
+        }
+    }
+
+    /// @brief call `fn(const Rect&)` for the colliders in the cells crossed by the segment from -> to, nearest first
+    /// @param fn returns false to stop the walk
+    template <typename Fn>
+    void raycast(const Vec2& from, const Vec2& to, Fn&& fn) const {
+        const Vec2 start = from - origin;
+        const Vec2 delta = to - from;
+
+        int x = cell(start.x);
+        int y = cell(start.y);
+        const int endX = cell(to.x - origin.x);
+        const int endY = cell(to.y - origin.y);
+        const int stepX = delta.x > 0 ? 1 : (delta.x < 0 ? -1 : 0);
+        const int stepY = delta.y > 0 ? 1 : (delta.y < 0 ? -1 : 0);
+        const Scalar dx = stepX < 0 ? -delta.x : delta.x;
+        const Scalar dy = stepY < 0 ? -delta.y : delta.y;
+
+        // Distance to the next vertical/horizontal cell edge. The ray crosses the
+        // vertical one first when distX / dx < distY / dy, which is compared
+        // multiplied out so that no division rounds
+        Scalar distX = stepX > 0 ? (Scalar)((x + 1) * cellSize) - start.x : start.x - (Scalar)(x * cellSize);
+        Scalar distY = stepY > 0 ? (Scalar)((y + 1) * cellSize) - start.y : start.y - (Scalar)(y * cellSize);
+
+        int steps = (endX > x ? endX - x : x - endX) + (endY > y ? endY - y : y - endY);
+
+        uint16_t previous = noCollider;
+        for (;;) {
+            if (x >= 0 && x < width && y >= 0 && y < height) {
+                const uint16_t collider = colliderOf[y * width + x];
+                if (collider != noCollider && collider != previous && !fn(colliders[collider])) {
+                    return;
+                }
+                previous = collider;
+            }
+            if (steps-- == 0) {
+                return;
+            }
+            if (stepY == 0 || (stepX != 0 && productLess(distX, dy, distY, dx))) {
+                x += stepX;
+                distX += cellSize;
+            } else {
+                y += stepY;
+                distY += cellSize;
+            }
+        }
+    }
+
+  private:
+    bool isFreeRun(int x, int y, int w) const {
+        for (int cx = x; cx < x + w; cx++) {
+            const int i = y * width + cx;
+            if (heights[i] != cellSize || colliderOf[i] != noCollider) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename F>
+    static int floor(F f) {
+        const int i = (int)f;
+        return (f < 0 && (F)i != f) ? i - 1 : i;
+    }
+
+    // a * b < c * d, exact for fixed point where the products would not fit a Scalar
+    static bool productLess(Scalar a, Scalar b, Scalar c, Scalar d) {
+#if FIXED_POINT_MATH
+        return (int64_t)a.raw * b.raw < (int64_t)c.raw * d.raw;
+#else
+        return a * b < c * d;
+#endif
+    }
+
+    static int cell(Scalar position) {
+        return floor(position / cellSize);
+    }
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "frame_cache.hpp"
+#include "math.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+// Off-screen 2bpp image of the static tiles, composed once and drawn with a
+// single blitSub. Pixels are packed like WASM-4 sprites, 4 per byte with the
+// leftmost in the high bits, and hold palette indices, so the layer is blitted
+// with DRAW_COLORS 0x4321. A 0 x 0 layer holds nothing and draws nothing.
+template <int width, int height>
+struct TileLayer {
+    static constexpr int layerWidth = width;
+    static constexpr int layerHeight = height;
+
+    std::array<uint8_t, (size_t)(width * height / 4)> pixels;
+    // World position of the top left pixel
+    Vec2 origin;
+
+    void clear(uint8_t color) {
+        const uint8_t i = (uint8_t)(color - 1);
+        std::fill(pixels.begin(), pixels.end(), (uint8_t)(i << 6 | i << 4 | i << 2 | i));
+    }
+
+    /// @brief draw a sprite from the tilemap like Renderer::drawSpriteFrame, at layer coordinates
+    /// @param drawColors DRAW_COLORS value to map the sprite through, 0 nibbles are transparent
+    void drawSpriteFrame(int id, int x, int y, uint16_t drawColors) {
+        const int index = storedFrame(id);
+        const bool flipX = frameFlips(id) & BLIT_FLIP_X;
+        const bool flipY = frameFlips(id) & BLIT_FLIP_Y;
+        uint8_t frame[maxFrameBytes];
+        decodeFrame(index, frame);
+        for (int row = 0; row < 16; row++) {
+            const int dy = y + row;
+            if (dy < 0 || dy >= height) {
+                continue;
+            }
+            for (int column = 0; column < 16; column++) {
+                const int dx = x + column;
+                if (dx < 0 || dx >= width) {
+                    continue;
+                }
+                const int value = framePixel(index, frame, flipX ? 15 - column : column, flipY ? 15 - row : row);
+                const int color = (drawColors >> (4 * value)) & 0xf;
+                if (color == 0) {
+                    continue;
+                }
+
+                const int dst = dy * width + dx;
+                const int shift = 6 - 2 * (dst % 4);
+                uint8_t& byte = pixels[(size_t)(dst / 4)];
+                byte = (uint8_t)((byte & ~(0x3 << shift)) | ((color - 1) << shift));
+            }
+        }
+    }
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "wasm4.h"
+
+#include "entity.hpp"
+#include "math.hpp"
+#include "object_pool.hpp"
+#include "tile_grid.hpp"
+
+struct World {
+    const Rect bounds = {{0, 0}, {SCREEN_SIZE, SCREEN_SIZE}};
+    using Grid = TileGrid<10, 11>;
+
+    // A tile per grid cell at most
+    ObjectPool<Tile, Grid::cellCount, PoolIteration::Packed> tiles;
+    Grid grid;
+    ObjectPool<Entity, 100, PoolIteration::Packed> entities;
+    Projectile::Pool<100> projectiles;
+};
@@ -0,0 +1,116 @@
+// Known answers for the fixed point collision math, built once per format by
+// `make test`. The expected values are raw integers, so every build of the
+// cart, WASM or native, has to reproduce them exactly.
+#include "math.hpp"
+#include "tile_grid.hpp"
+
+#include <stdio.h>
+
+#if !FIXED_POINT_MATH
+#error "build with -DFIXED_POINT_MATH=32 or =16"
+#endif
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        printf("FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+// Raw value expected in Q16.16 and in Q12.4
+long long expected(long long q16, long long q12) {
+    return FIXED_POINT_MATH == 32 ? q16 : q12;
+}
+
+void overlap() {
+    const Rect a = {{0, 0}, {16, 16}};
+    check(a.collision({{16, 0}, {16, 16}}), "rects sharing an edge collide");
+    check(a.collision({{16, 16}, {4, 4}}), "rects sharing a corner collide");
+    check(!a.collision({{Scalar::fromRaw(Scalar(16).raw + 1), 0}, {16, 16}}), "a raw step apart does not collide");
+    check(!a.collision({{0, -5}, {16, Scalar::fromRaw(Scalar(5).raw - 1)}}), "a raw step above does not collide");
+
+    const Rect rect = {{20, 20}, {10, 10}};
+    const Rect rects[] = {
+        {{0, 0}, {10, 10}},   // apart
+        {{30, 30}, {5, 5}},   // corner
+        {{25, 0}, {2, 19}},   // just above
+        {{-5, 22}, {25, 1}},  // touching the left edge
+        {{31, 20}, {1, 1}},   // just right
+        {{22, 22}, {2, 2}},   // inside
+    };
+    check(math::collisionMask(rect, rects, 6) == 0x2a, "collisionMask of 6 rects");
+    check(math::collisionMask(rect, rects, 3) == 0x02, "collisionMask only tests count rects");
+}
+
+void raycast() {
+    Scalar t;
+
+    check(Rect{{32, 16}, {16, 16}}.raycast({0, 20}, {64, 20}, t) && t.raw == expected(32768, 8), "hit half way");
+    check(Rect{{32, 16}, {16, 16}}.raycast({0, 20}, {48, 20}, t) && t.raw == expected(43690, 10),
+          "hit two thirds of the way, truncated");
+    check(Rect{{32, 16}, {16, 16}}.raycast({60, 20}, {0, 20}, t) && t.raw == expected(13107, 3),
+          "hit from the right, truncated towards zero");
+    check(Rect{{10, 20}, {20, 20}}.raycast({0, 0}, {30, 50}, t) && t.raw == expected(26214, 6),
+          "diagonal hit enters through the top");
+    check(!Rect{{10, 20}, {20, 20}}.raycast({0, 0}, {10, 50}, t), "diagonal passing the corner misses");
+    check(!Rect{{32, 16}, {16, 16}}.raycast({0, 40}, {64, 40}, t), "parallel segment outside misses");
+}
+
+// Cells of a 4x4 checkerboard, where every cell is a collider of its own
+struct Walk {
+    int cells[8];
+    int count;
+};
+
+Walk walk(const Vec2& from, const Vec2& to) {
+    static TileGrid<4, 4> grid;
+    for (int y = 0; y < 4; y++) {
+        for (int x = 0; x < 4; x++) {
+            grid.set(x, y, (x + y) % 2 ? 15 : 16);
+        }
+    }
+    grid.build();
+
+    Walk out = {};
+    grid.raycast(from, to, [&](const Rect& collider) {
+        const auto i = &collider - grid.colliders;
+        out.cells[out.count++] = grid.colliderY[i] * 4 + grid.colliderX[i];
+        return out.count < 8;
+    });
+    return out;
+}
+
+bool same(const Walk& walk, std::initializer_list<int> cells) {
+    int i = 0;
+    for (int cell : cells) {
+        if (i >= walk.count || walk.cells[i++] != cell) {
+            return false;
+        }
+    }
+    return i == walk.count;
+}
+
+void gridRaycast() {
+    check(same(walk({8, 8}, {56, 40}), {0, 1, 5, 6, 10, 11}), "grid walk along a 2:3 slope");
+    // Through the corner of a cell the row changes before the column
+    check(same(walk({8, 8}, {40, 40}), {0, 4, 5, 9, 10}), "grid walk through cell corners");
+    check(same(walk({60, 4}, {4, 4}), {3, 2, 1, 0}), "grid walk to the left");
+    check(same(walk({-8, 24}, {24, 24}), {4, 5}), "grid walk from outside the grid");
+}
+
+} // namespace
+
+int main() {
+    overlap();
+    raycast();
+    gridRaycast();
+
+    if (failures == 0) {
+        printf("ok\n");
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,181 @@
+// Host checks for the pools, built and run with `make test`
+#include "object_pool.hpp"
+#include "soa_pool.hpp"
+
+#include <stdio.h>
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        printf("FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+struct Object {
+    int value;
+};
+
+void objectPoolReusesFreedSlotsFirst() {
+    static ObjectPool<Object, 4> pool;
+
+    auto a = pool.create(1);
+    auto b = pool.create(2);
+    auto c = pool.create(3);
+    check((uint16_t)a == 0 && (uint16_t)b == 1 && (uint16_t)c == 2, "unused slots are taken in order");
+
+    pool.free(a);
+    pool.free(c);
+    auto d = pool.create(4);
+    auto e = pool.create(5);
+    auto f = pool.create(6);
+    check((uint16_t)d == 2, "the last freed slot is reused first");
+    check((uint16_t)e == 0, "then the one freed before it");
+    check((uint16_t)f == 3, "then the unused slots");
+    check(pool.create(7) == pool.invalid_handle, "a full pool refuses to allocate");
+
+    check(pool.get(a) == nullptr && pool.get(c) == nullptr, "handles to freed objects are stale");
+    check(pool.get(d)->value == 4 && pool.get(e)->value == 5, "handles to reused slots are live");
+    check((d >> 16) == (c >> 16) + 2, "a reused slot moves its check past the freed handle");
+
+    pool.free(c);
+    check(pool.count() == 4, "freeing a stale handle does nothing");
+}
+
+template <PoolIteration iteration>
+void objectPoolFreeWhileIterating() {
+    static ObjectPool<Object, 8, iteration> pool;
+
+    typename ObjectPool<Object, 8, iteration>::Handle handles[8];
+    for (int i = 0; i < 8; i++) {
+        handles[i] = pool.create(i);
+    }
+    int visited = 0;
+    int seen = 0;
+    for (auto& object : pool) {
+        visited++;
+        seen |= 1 << object.value;
+        if (object.value % 2 == 0) {
+            pool.free(&object);
+        }
+    }
+    check(visited == 8 && seen == 0xff, "every object is visited once while the current one is freed");
+    check(pool.count() == 4, "the freed objects are gone");
+
+    int left = 0;
+    for (auto& object : pool) {
+        left |= 1 << object.value;
+    }
+    check(left == 0xaa, "only the objects that were not freed are left");
+
+    bool found = true;
+    for (int i = 0; i < 8; i++) {
+        const Object* object = pool.get(handles[i]);
+        found = found && (i % 2 == 0 ? object == nullptr : object != nullptr && object->value == i);
+    }
+    check(found, "handles still find the objects that are left");
+}
+
+template <PoolIteration iteration>
+void objectPoolFreeThenReallocThenDefer() {
+    static ObjectPool<Object, 4, iteration> pool;
+
+    auto a = pool.create(1);
+    check(pool.deferFree(a), "queue a");
+    pool.free(a);
+    auto b = pool.create(2);
+    check((uint16_t)a == (uint16_t)b, "b reuses the slot of a");
+    check(pool.deferFree(b), "queue b in the slot a was queued in");
+    check(!pool.deferFree(b), "queue b twice");
+    check(pool.pendingCount == 1, "freeing a took it off the queue");
+
+    pool.flush();
+    check(pool.get(b) == nullptr, "flush frees b");
+    check(pool.count() == 0, "pool is empty after flush");
+}
+
+void objectPoolQueueStaysBounded() {
+    static ObjectPool<Object, 4> pool;
+
+    // Without taking freed objects off the queue this would queue 8 handles
+    for (int round = 0; round < 2; round++) {
+        ObjectPool<Object, 4>::Handle handles[4];
+        for (auto& handle : handles) {
+            handle = pool.create(round);
+            pool.deferFree(handle);
+        }
+        for (auto handle : handles) {
+            pool.free(handle);
+        }
+    }
+    check(pool.pendingCount == 0, "freed objects leave the queue");
+}
+
+void soaPoolFreeAtMovesTheLastObject() {
+    using Pool = SoaPool<4, int, float>;
+    static Pool pool;
+
+    Pool::Handle handles[4];
+    for (int i = 0; i < 4; i++) {
+        handles[i] = pool.create(i, (float)i / 2);
+    }
+    pool.freeAt(1);
+    check(pool.count() == 3, "freeAt removes one object");
+    check(pool.get<0>(handles[1]) == nullptr, "the freed handle is stale");
+    check(pool.position(handles[3]) == 1, "the last object moves into the freed position");
+    check(*pool.get<0>(handles[3]) == 3 && *pool.get<1>(handles[3]) == 1.5f, "every field moves with it");
+
+    const auto values = pool.field<0>();
+    check(values.size() == 3 && values[0] == 0 && values[1] == 3 && values[2] == 2, "the live fields stay packed");
+
+    bool consistent = true;
+    for (size_t i = 0; i < pool.count(); i++) {
+        consistent = consistent && pool.position(pool.handle(i)) == (int)i;
+    }
+    check(consistent, "ids and positions agree for every live object");
+
+    auto reused = pool.create(7, 0.0f);
+    check((uint16_t)reused == (uint16_t)handles[1] && reused != handles[1], "the freed id is reused with a new check");
+    check(pool.position(reused) == 3 && *pool.get<0>(reused) == 7, "a new object is appended");
+
+    pool.freeAt(pool.count() - 1);
+    check(pool.get<0>(reused) == nullptr && *pool.get<0>(handles[2]) == 2, "freeing the last object moves nothing");
+}
+
+void soaPoolFreeThenReallocThenDefer() {
+    static SoaPool<4, int> pool;
+
+    auto a = pool.create(1);
+    check(pool.deferFree(0), "queue a");
+    pool.free(a);
+    auto b = pool.create(2);
+    check((uint16_t)a == (uint16_t)b, "b reuses the id of a");
+    check(pool.deferFree(0), "queue b with the id a was queued with");
+    check(!pool.deferFree(0), "queue b twice");
+    check(!pool.deferFree(1), "queue a position past the live objects");
+
+    pool.flush();
+    check(pool.get<0>(b) == nullptr, "flush frees b");
+    check(pool.count() == 0, "pool is empty after flush");
+}
+
+} // namespace
+
+int main() {
+    objectPoolReusesFreedSlotsFirst();
+    objectPoolFreeWhileIterating<PoolIteration::Scan>();
+    objectPoolFreeWhileIterating<PoolIteration::Packed>();
+    objectPoolFreeThenReallocThenDefer<PoolIteration::Scan>();
+    objectPoolFreeThenReallocThenDefer<PoolIteration::Packed>();
+    objectPoolQueueStaysBounded();
+    soaPoolFreeAtMovesTheLastObject();
+    soaPoolFreeThenReallocThenDefer();
+
+    if (failures == 0) {
+        printf("ok\n");
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+"""Convert a sprite sheet PNG into headers of compressed 16x16 frames.
+
+    python3 tools/compress_tilemap.py assets/monochrome_tilemap_packed.png src/assets/tilemap_lz.hpp \\
+        --data src/assets/tilemap_data.hpp --code src/assets.hpp --level src/assets/level.hpp
+
+The output header only declares the frame data, which --data defines for
+src/assets.cpp, so that a single translation unit compiles it.
+
+`make assets` runs this. The PNG has to use a palette or grayscale at 1 or 2
+bits per pixel. 2 bit pixels are palette indices as they are, 1 bit pixels
+become index 0 and 3.
+
+With --code or --level only the frames referenced there are kept: every
+spriteIndex(i, j) in the --code files and every non-zero entry of the arrays
+in the --level files. A frame that equals an earlier one, or an earlier one
+flipped, is not stored again. tilemapSheetFrames lists the referenced frames
+in ascending order and tilemapRemap what to draw for each, for
+assets::atlasFrame(): the stored frame, with the BLIT_FLIP_X and BLIT_FLIP_Y
+that turn it into the referenced one shifted up by 12 bits.
+
+Frames that use at most two colours are stored at 1bpp, 16 rows of 2 bytes
+with a set bit for the higher palette index, and tilemapFrameFormats records
+the indices that 0 and 1 stand for. Other frames are stored at 2bpp, 16 rows
+of 4 bytes. Either is packed with a small LZ scheme that src/frame_cache.hpp
+decodes:
+
+    flags   one byte ahead of every 8 items, bit i set when item i is a match
+    literal one byte, copied as is
+    match   one byte, (offset - 1) << 4 | (length - 2): copy `length` bytes
+            starting `offset` (1-16) bytes back in the frame being decoded
+
+The output only depends on the inputs, so it can be committed and diffed.
+"""
+
+import argparse
+import re
+import struct
+import zlib
+
+FRAME = 16
+FRAME_BYTES = FRAME * FRAME // 4
+# Format bit for frames stored at 1bpp, the low nibble holds the index for a 0
+# bit in bits 0-1 and the one for a 1 bit in bits 2-3
+ONE_BIT = 0x10
+MAX_OFFSET = 16
+MAX_LENGTH = 17
+# wasm4.h
+BLIT_FLIP_X = 2
+BLIT_FLIP_Y = 4
+FLIP_SHIFT = 12
+
+
+def read_png(path):
+    """Return the width, height and rows of palette indices of a PNG"""
+    data = open(path, "rb").read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise SystemExit(f"{path}: not a PNG")
+    pos = 8
+    compressed = b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos : pos + 8])
+        body = data[pos + 8 : pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"IDAT":
+            compressed += body
+    if color_type not in (0, 3) or depth not in (1, 2) or interlace:
+        raise SystemExit(f"{path}: needs a non-interlaced 1 or 2 bit palette or grayscale image")
+
+    raw = zlib.decompress(compressed)
+    stride = (width * depth + 7) // 8
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind, line = raw[start], bytearray(raw[start + 1 : start + 1 + stride])
+        for i in range(stride):
+            left = line[i - 1] if i > 0 else 0
+            up = previous[i]
+            up_left = previous[i - 1] if i > 0 else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (left + up) // 2) & 0xFF
+            elif kind == 4:
+                estimate = left + up - up_left
+                nearest = min((abs(estimate - left), 0, left), (abs(estimate - up), 1, up), (abs(estimate - up_left), 2, up_left))
+                line[i] = (line[i] + nearest[2]) & 0xFF
+        previous = line
+        per_byte = 8 // depth
+        mask = (1 << depth) - 1
+        values = [(line[x // per_byte] >> (8 - depth * (x % per_byte + 1))) & mask for x in range(width)]
+        rows.append([value * 3 if depth == 1 else value for value in values])
+    return width, height, rows
+
+
+def referenced(code, levels, columns):
+    used = set()
+    for path in code:
+        for i, j in re.findall(r"spriteIndex\((\d+),\s*(\d+)\)", open(path).read()):
+            used.add(int(j) * columns + int(i))
+    for path in levels:
+        text = open(path).read()
+        for body in re.findall(r"\]\s*=\s*\{([^}]*)\}", text):
+            used.update(int(value) for value in re.findall(r"\d+", body) if int(value) != 0)
+    return sorted(used)
+
+
+def frames(width, height, rows):
+    """Yield every frame as a tuple of 256 palette indices, row by row"""
+    for fy in range(height // FRAME):
+        for fx in range(width // FRAME):
+            yield tuple(
+                rows[fy * FRAME + row][fx * FRAME + column] for row in range(FRAME) for column in range(FRAME)
+            )
+
+
+def flipped(frame, flags):
+    return tuple(
+        frame[(FRAME - 1 - row if flags & BLIT_FLIP_Y else row) * FRAME + (FRAME - 1 - column if flags & BLIT_FLIP_X else column)]
+        for row in range(FRAME)
+        for column in range(FRAME)
+    )
+
+
+def encode(frame):
+    """Return the format byte and stored bytes of a frame"""
+    colors = sorted(set(frame))
+    if len(colors) > 2:
+        return 0, bytes(a << 6 | b << 4 | c << 2 | d for a, b, c, d in zip(*[iter(frame)] * 4))
+    zero, one = colors[0], colors[-1]
+    bits = [1 if value == one and one != zero else 0 for value in frame]
+    return ONE_BIT | zero | one << 2, bytes(sum(bit << (7 - i) for i, bit in enumerate(byte)) for byte in zip(*[iter(bits)] * 8))
+
+
+def decode(format, data):
+    """Return the frame stored as `data`, the inverse of encode()"""
+    if format & ONE_BIT:
+        bits = [(byte >> (7 - i)) & 1 for byte in data for i in range(8)]
+        return tuple((format >> (2 * bit)) & 0x3 for bit in bits)
+    return tuple((byte >> shift) & 0x3 for byte in data for shift in (6, 4, 2, 0))
+
+
+def compress(frame):
+    items = []
+    i = 0
+    while i < len(frame):
+        best, best_offset = 0, 0
+        for offset in range(1, min(i, MAX_OFFSET) + 1):
+            length = 0
+            while i + length < len(frame) and length < MAX_LENGTH and frame[i + length - offset] == frame[i + length]:
+                length += 1
+            if length > best:
+                best, best_offset = length, offset
+        if best >= 2:
+            items.append((True, (best_offset - 1) << 4 | (best - 2)))
+            i += best
+        else:
+            items.append((False, frame[i]))
+            i += 1
+
+    out = bytearray()
+    for group in range(0, len(items), 8):
+        chunk = items[group : group + 8]
+        out.append(sum(1 << bit for bit, (match, _) in enumerate(chunk) if match))
+        out += bytes(value for _, value in chunk)
+    return bytes(out)
+
+
+def decompress(data, size):
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        flags = data[i]
+        i += 1
+        for bit in range(8):
+            if len(out) == size:
+                break
+            if flags & (1 << bit):
+                offset, length = (data[i] >> 4) + 1, (data[i] & 0xF) + 2
+                for _ in range(length):
+                    out.append(out[-offset])
+            else:
+                out.append(data[i])
+            i += 1
+    return bytes(out)
+
+
+def array(values, per_line, fmt):
+    lines = []
+    for start in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt.format(v) for v in values[start : start + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input")
+    parser.add_argument("output")
+    parser.add_argument("--data", required=True, help="header defining the arrays that output declares")
+    parser.add_argument("--code", nargs="*", default=[], help="sources to scan for spriteIndex(i, j)")
+    parser.add_argument("--level", nargs="*", default=[], help="headers with arrays of frame indices")
+    args = parser.parse_args()
+    width, height, rows = read_png(args.input)
+
+    sheet = list(frames(width, height, rows))
+    kept = list(range(len(sheet)))
+    if args.code or args.level:
+        kept = referenced(args.code, args.level, width // FRAME)
+        missing = [index for index in kept if index >= len(sheet)]
+        if missing:
+            raise SystemExit(f"frames {missing} are not on the {len(sheet)} frame sheet")
+
+    # Every stored frame under each of its flips, to find repeats
+    known = {}
+    remap = []
+    blob = bytearray()
+    offsets = []
+    formats = []
+    for frame in (sheet[index] for index in kept):
+        if frame in known:
+            remap.append(known[frame])
+            continue
+        slot = len(offsets)
+        for flags in (0, BLIT_FLIP_X, BLIT_FLIP_Y, BLIT_FLIP_X | BLIT_FLIP_Y):
+            known.setdefault(flipped(frame, flags), slot | flags << FLIP_SHIFT)
+        remap.append(slot)
+
+        format, stored = encode(frame)
+        packed = compress(stored)
+        assert decode(format, decompress(packed, len(stored))) == frame
+        offsets.append(len(blob))
+        formats.append(format)
+        blob += packed
+    offsets.append(len(blob))
+    if len(blob) > 0xFFFF or len(formats) >= 1 << FLIP_SHIFT:
+        raise SystemExit("compressed sheet does not fit the uint16_t tables")
+
+    declarations = f"""// v. 1.0.0 tilemap, generated by tools/compress_tilemap.py from {args.input.split("/")[-1]}
+// {len(kept)} of {len(sheet)} 16x16 frames referenced, {len(formats)} stored, {sum(1 for f in formats if f)} of them at 1bpp, compressed to {len(blob)} bytes
+inline const int tilemapWidth = {width};
+inline const int tilemapHeight = {height};
+inline const int tilemapFlags = BLIT_2BPP;
+inline const int tilemapFrames = {len(formats)};
+// Largest frame once decoded, 32 bytes when every frame is stored at 1bpp
+inline const int tilemapFrameBytes = {FRAME_BYTES // 2 if all(formats) else FRAME_BYTES};
+// Index on the full sheet of each referenced frame, ascending
+inline const int tilemapReferenced = {len(kept)};
+inline constexpr uint16_t tilemapSheetFrames[{len(kept)}] = {{
+{array(kept, 12, "{}")}
+}};
+// Stored frame to draw for each of tilemapSheetFrames, with the flips to draw it
+// with in BLIT_FLIP_X << 12 and BLIT_FLIP_Y << 12
+inline constexpr uint16_t tilemapRemap[{len(kept)}] = {{
+{array(remap, 12, "0x{:04x}")}
+}};
+// 0 for frames stored at 2bpp; for 1bpp frames 0x10, with the palette index
+// drawn for a 0 bit in bits 0-1 and the one for a 1 bit in bits 2-3
+extern const uint8_t tilemapFrameFormats[{len(formats)}];
+// Where each frame starts in tilemapData, and one past the last frame
+extern const uint16_t tilemapOffsets[{len(offsets)}];
+extern const uint8_t tilemapData[{len(blob)}];
+"""
+    definitions = f"""// v. 1.0.0 tilemap, generated by tools/compress_tilemap.py from {args.input.split("/")[-1]}
+// Only included by src/assets.cpp, {args.output.split("/")[-1]} declares these
+const uint8_t tilemapFrameFormats[{len(formats)}] = {{
+{array(formats, 12, "0x{:02x}")}
+}};
+const uint16_t tilemapOffsets[{len(offsets)}] = {{
+{array(offsets, 12, "{}")}
+}};
+const uint8_t tilemapData[{len(blob)}] = {{
+{array(blob, 16, "0x{:02x}")}
+}};
+"""
+    for path, text in ((args.output, declarations), (args.data, definitions)):
+        with open(path, "w", newline="\n") as out:
+            out.write(text)
+
+if __name__ == "__main__":
+    main()